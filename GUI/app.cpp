@@ -11,6 +11,7 @@
 #include "include\mainWindowFrame.h"
 #include "include\memoryViewerFrame.h"
 #include "include\cpuStateFrame.h"
+#include "include\profilerFrame.h"
 #include "include\paletteViewerFrame.h"
 #include "include\tileViewerFrame.h"
 #include "include\oamViewerFrame.h"
@@ -42,6 +43,7 @@ wxBEGIN_EVENT_TABLE(MainWindowFrame, wxFrame)
 	EVT_MENU(wxMenuIDs::RESET_GAMEBOY, MainWindowFrame::OnMenuResetGameBoyButton)
 	
 	EVT_MENU(wxMenuIDs::OPEN_CPU_STATE_VIEW, MainWindowFrame::OnMenuOpenCPUStateViewButton)
+	EVT_MENU(wxMenuIDs::OPEN_PROFILER_VIEW, MainWindowFrame::OnMenuOpenProfilerViewButton)
 	EVT_MENU(wxMenuIDs::OPEN_MEMORY_VIEWER_VIEW, MainWindowFrame::OnMenuOpenMemoryViewerViewButton)
 	EVT_MENU(wxMenuIDs::OPEN_PALETTE_VIEWER_VIEW, MainWindowFrame::OnMenuOpenPaletteViewerViewButton)
 	EVT_MENU(wxMenuIDs::OPEN_TILE_VIEWER_VIEW, MainWindowFrame::OnMenuOpenTileViewerViewButton)
@@ -58,11 +60,24 @@ wxBEGIN_EVENT_TABLE(MainWindowFrame, wxFrame)
 	EVT_MENU(wxMenuIDs::DISPLAY_SIZE_4, MainWindowFrame::handleTimes4SizeEvent)
 	EVT_MENU(wxMenuIDs::DISPLAY_SIZE_5, MainWindowFrame::handleTimes5SizeEvent)
 
+	EVT_MENU(wxMenuIDs::TOGGLE_FAST_FORWARD_MENU, MainWindowFrame::OnMenuToggleFastForwardButton)
+	EVT_MENU(wxMenuIDs::FAST_FORWARD_SPEED_2, MainWindowFrame::handleFastForward2xEvent)
+	EVT_MENU(wxMenuIDs::FAST_FORWARD_SPEED_4, MainWindowFrame::handleFastForward4xEvent)
+	EVT_MENU(wxMenuIDs::FAST_FORWARD_SPEED_UNCAPPED, MainWindowFrame::handleFastForwardUncappedEvent)
+	EVT_MENU(wxMenuIDs::TOGGLE_THREADED_DISPATCH_MENU, MainWindowFrame::OnMenuToggleThreadedDispatchButton)
+	EVT_MENU(wxMenuIDs::TOGGLE_JIT_MENU, MainWindowFrame::OnMenuToggleJITButton)
+
 	EVT_MENU(wxMenuIDs::PAUSE_EMULATION_MENU, MainWindowFrame::OnMenuPauseButton)
 	EVT_MENU(wxMenuIDs::CONTINUE_EMULATION_MENU, MainWindowFrame::OnMenuContinueButton)
 	EVT_MENU(wxMenuIDs::STEP_FRAME_MENU, MainWindowFrame::OnMenuStepFrameButton)
 	EVT_MENU(wxMenuIDs::STEP_CPU_MENU, MainWindowFrame::OnMenuStepCPUButton)
 	EVT_MENU(wxMenuIDs::OPEN_BREAKPOINT_MANAGER, MainWindowFrame::OnMenuOpenBreakpointManagerViewButton)
+	EVT_MENU(wxMenuIDs::TOGGLE_TRACE_MENU, MainWindowFrame::OnMenuToggleTraceButton)
+	EVT_MENU(wxMenuIDs::TOGGLE_TRACE_COMPRESSION_MENU, MainWindowFrame::OnMenuToggleTraceCompressionButton)
+	EVT_MENU(wxMenuIDs::TOGGLE_AOT_RECORDING_MENU, MainWindowFrame::OnMenuToggleAOTRecordingButton)
+	EVT_MENU(wxMenuIDs::RTC_HOST_CLOCK_MENU, MainWindowFrame::handleRTCHostClockEvent)
+	EVT_MENU(wxMenuIDs::RTC_EMULATED_CLOCK_MENU, MainWindowFrame::handleRTCEmulatedClockEvent)
+	EVT_MENU(wxMenuIDs::RTC_FIXED_TIME_MENU, MainWindowFrame::handleRTCFixedTimeEvent)
 wxEND_EVENT_TABLE()
 
 wxBEGIN_EVENT_TABLE(CPUStateFrame, wxFrame)
@@ -70,6 +85,11 @@ wxBEGIN_EVENT_TABLE(CPUStateFrame, wxFrame)
 	EVT_COMMAND(wxID_ANY, EMULATOR_CORE_UPDATE_EVENT, CPUStateFrame::handleEmulatorCoreUpdateEvent)
 wxEND_EVENT_TABLE()
 
+wxBEGIN_EVENT_TABLE(ProfilerFrame, wxFrame)
+	EVT_CLOSE(ProfilerFrame::OnCloseWindow)
+	EVT_COMMAND(wxID_ANY, EMULATOR_CORE_UPDATE_EVENT, ProfilerFrame::handleEmulatorCoreUpdateEvent)
+wxEND_EVENT_TABLE()
+
 wxBEGIN_EVENT_TABLE(MemoryViewerFrame, wxFrame)
 	EVT_CLOSE(MemoryViewerFrame::OnCloseWindow)
 	EVT_COMMAND(wxID_ANY, EMULATOR_CORE_UPDATE_EVENT, MemoryViewerFrame::handleEmulatorCoreUpdateEvent)
@@ -154,6 +174,8 @@ bool App::OnInit()
 
 	// Create the emulator core object.
 	emuCore = new Core(PAUSE);
+	if (!emuCore->isInitialized()) exit(1);
+	if (!parseCommandLine()) exit(1);
 
 	// Create the main window frame.
 	mainWindow = new MainWindowFrame(emuCore, this);
@@ -180,6 +202,10 @@ bool App::OnInit()
 	cpuStateFrame = new CPUStateFrame(emuCore, emuThread);
 	cpuStateFrame->Hide();
 
+	// Create the profiler display.
+	profilerFrame = new ProfilerFrame(emuCore, emuThread);
+	profilerFrame->Hide();
+
 	// Create the memory viewer displays.
 	memoryViewerFrame = new MemoryViewerFrame(emuCore, emuThread);
 	memoryViewerFrame->Hide();
@@ -212,6 +238,28 @@ bool App::OnInit()
 	return runningEmulator;
 }
 
+bool App::parseCommandLine(){
+	for (int i = 1; i < argc; i++) {
+		wxString option = argv[i];
+		// How often battery saves are written out, in milliseconds.
+		if (option == "--battery-save-interval" && i + 1 < argc) {
+			long milliseconds = 0;
+			if (!argv[++i].ToLong(&milliseconds) || milliseconds <= 0) {
+				std::cerr << "ERROR: --battery-save-interval expects a positive number of milliseconds!" << std::endl;
+				return false;
+			}
+			emuCore->getCartridge()->setBatterySaveInterval((int)milliseconds);
+		// Run hot code through the recompiler from the start.
+		} else if (option == "--jit") {
+			emuCore->setJITEnabled(true);
+		} else {
+			std::cerr << "ERROR: Unknown option \"" << option << "\"!" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
 int App::OnExit()
 {
 	// Stop the emulator.
@@ -238,6 +286,10 @@ void App::closeAllSideFrames()
 		cpuStateFrame->Destroy();
 		cpuStateFrame = nullptr;
 	}
+	if (profilerFrame != nullptr){
+		profilerFrame->Destroy();
+		profilerFrame = nullptr;
+	}
 	if (memoryViewerFrame != nullptr){
 		memoryViewerFrame->Destroy();
 		memoryViewerFrame = nullptr;
@@ -354,6 +406,8 @@ void App::sendEmulationCoreUpdateEvent(){
 		wxPostEvent(mainWindow, event);
 	if (cpuStateFrame != nullptr && cpuStateFrame->IsShown())
 		wxPostEvent(cpuStateFrame, event);
+	if (profilerFrame != nullptr && profilerFrame->IsShown())
+		wxPostEvent(profilerFrame, event);
 	if (memoryViewerFrame != nullptr && memoryViewerFrame->IsShown())
 		wxPostEvent(memoryViewerFrame, event);
 	if (paletteViewerFrame != nullptr && paletteViewerFrame->IsShown())
@@ -390,6 +444,11 @@ void App::showCPUStateFrame()
 	if (cpuStateFrame != nullptr)
 		cpuStateFrame->Show(true);
 }
+void App::showProfilerFrame()
+{
+	if (profilerFrame != nullptr)
+		profilerFrame->Show(true);
+}
 void App::showMemoryViewerFrame()
 {
 	if (memoryViewerFrame != nullptr)
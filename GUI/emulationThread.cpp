@@ -99,6 +99,14 @@ void* EmulationThread::Entry()
 	emuCore->controller.bindKeyUp(SDL_SCANCODE_E, std::bind(&Joypad::releaseStart, emuCore->getJoypad()));
 	emuCore->controller.bindKeyDown(SDL_SCANCODE_E, std::bind(&Joypad::pressStart, emuCore->getJoypad()));
 
+	// Fast-forward.
+	emuCore->controller.bindKeyUp(FAST_FORWARD_KEY, std::bind(&EmulationThread::toggleFastForward, this));
+
+	// Start measuring the emulation speed from here.
+	speedSampleStartTime = SDL_GetTicks64();
+	speedSampleStartFrame = emuCore->getFramesEmulated();
+	speedSampleStartIdleCycles = emuCore->getCPU()->getIdleCyclesSkipped();
+
 	// Main event loop.
 	while (appContext->getRunningEmulationState())
 	{
@@ -109,7 +117,7 @@ void* EmulationThread::Entry()
 		sdlEventHandler();
 
 		// Runs the emulator.
-		emuCore->emulatorMain();
+		runFrames();
 
 		PPU* ppu = emuCore->getPPU();
 		// Copy the entire background layer into a texture.
@@ -145,6 +153,7 @@ void* EmulationThread::Entry()
 
 		// Calculate the framerate.
 		updateAndGetFrameDelta();
+		updateEmulationSpeed();
 		// Prevent a division by zero error.
 		if(frameDelta == 0){
 			currentFPS = 0;
@@ -165,6 +174,54 @@ void* EmulationThread::Entry()
 	return (wxThread::ExitCode)true;
 }
 
+void EmulationThread::setFastForward(bool state){
+	fastForwarding = state;
+	// Audio made faster than normal speed cannot be played in time.
+	emuCore->acquireMutexLock();
+	emuCore->setAudioMuted(state);
+	emuCore->releaseMutexLock();
+}
+
+void EmulationThread::runFrames(){
+	int speed = fastForwarding ? (int)fastForwardSpeed : 1;
+
+	// Uncapped runs until the display is next due, so waiting on the display's
+	// refresh as well would halve its speed.
+	bool wantVsync = speed != FAST_FORWARD_UNCAPPED;
+	if(wantVsync != vsyncEnabled){
+		SDL_RenderSetVSync(sdlRenderer, wantVsync);
+		vsyncEnabled = wantVsync;
+	}
+
+	// Only the last frame run is shown, the ones before it are skipped. Stop
+	// early once the core stops, ie when paused or on a breakpoint.
+	for(int frame = 0; speed == FAST_FORWARD_UNCAPPED || frame < speed; frame++){
+		uint64_t framesBefore = emuCore->getFramesEmulated();
+		emuCore->emulatorMain();
+		if(emuCore->getFramesEmulated() == framesBefore) return;
+		if(speed == FAST_FORWARD_UNCAPPED && updateAndGetFrameDelta() >= targetFrameTime) return;
+	}
+}
+
+void EmulationThread::updateEmulationSpeed(){
+	Uint64 sampleLength = frameEndTime - speedSampleStartTime;
+	if(sampleLength < SPEED_SAMPLE_INTERVAL) return;
+
+	// The frames run against the frames normal speed would have run.
+	uint64_t framesEmulated = emuCore->getFramesEmulated();
+	emulationSpeed = (framesEmulated - speedSampleStartFrame) * MILLISECOND_FACTOR / (sampleLength * (double)TARGET_FPS);
+
+	// The cycles skipped against every cycle the CPU ran in those frames.
+	CPU* cpu = emuCore->getCPU();
+	uint64_t idleCycles = cpu->getIdleCyclesSkipped();
+	uint64_t cpuCycles = (framesEmulated - speedSampleStartFrame) * LCD_CYCLES_PER_FRAME * (cpu->getDoubleSpeedMode() ? 2 : 1);
+	idleSkipShare = cpuCycles ? (idleCycles - speedSampleStartIdleCycles) / (double)cpuCycles : 0;
+
+	speedSampleStartTime = frameEndTime;
+	speedSampleStartFrame = framesEmulated;
+	speedSampleStartIdleCycles = idleCycles;
+}
+
 void EmulationThread::sdlEventHandler(){
 	// Loop over all SDL2 events.
     while( SDL_PollEvent( &sdlEvent ) ){
@@ -19,6 +19,7 @@
 class EmulationThread;
 class MainWindowFrame;
 class CPUStateFrame;
+class ProfilerFrame;
 class Core;
 class MemoryViewerFrame;
 class PaletteViewerFrame;
@@ -31,6 +32,7 @@ class BreakpointManagerFrame;
 // An Enum defining the wxIDs used for each of the custom menu bar actions.
 enum wxMenuIDs {
 	OPEN_CPU_STATE_VIEW = 1,
+	OPEN_PROFILER_VIEW,
 	OPEN_MEMORY_VIEWER_VIEW,
 	OPEN_PALETTE_VIEWER_VIEW,
 	OPEN_TILE_VIEWER_VIEW,
@@ -43,6 +45,9 @@ enum wxMenuIDs {
 	STEP_FRAME_MENU,
 	STEP_CPU_MENU,
 	OPEN_BREAKPOINT_MANAGER,
+	TOGGLE_TRACE_MENU,
+	TOGGLE_TRACE_COMPRESSION_MENU,
+	TOGGLE_AOT_RECORDING_MENU,
 	DISPLAY_SIZE_1,
 	DISPLAY_SIZE_2,
 	DISPLAY_SIZE_3,
@@ -52,7 +57,16 @@ enum wxMenuIDs {
 	CLOSE_ROM,
 	RESET_GAMEBOY,
 	SAVE_STATE_1,
-	LOAD_STATE_1
+	LOAD_STATE_1,
+	TOGGLE_FAST_FORWARD_MENU,
+	FAST_FORWARD_SPEED_2,
+	FAST_FORWARD_SPEED_4,
+	FAST_FORWARD_SPEED_UNCAPPED,
+	TOGGLE_THREADED_DISPATCH_MENU,
+	TOGGLE_JIT_MENU,
+	RTC_HOST_CLOCK_MENU,
+	RTC_EMULATED_CLOCK_MENU,
+	RTC_FIXED_TIME_MENU
 };
 
 const char APP_TITLE[] = "RedPandaEmu";
@@ -64,6 +78,10 @@ const char CPU_STATE_DISPLAY_TITLE[] = "CPU State";
 #define CPU_STATE_DISPLAY_WIDTH 300
 #define CPU_STATE_DISPLAY_HEIGHT 355
 
+const char PROFILER_DISPLAY_TITLE[] = "Profiler";
+#define PROFILER_DISPLAY_WIDTH 520
+#define PROFILER_DISPLAY_HEIGHT 560
+
 const char MEMORY_VIEWER_DISPLAY_TITLE[] = "Memory Viewer";
 #define MEMORY_VIEWER_DISPLAY_WIDTH 700
 #define MEMORY_VIEWER_DISPLAY_HEIGHT 500
@@ -141,6 +159,11 @@ public:
 	 */
 	void showCPUStateFrame();
 
+	/**
+	 * @brief Reveals the profiler frame.
+	 */
+	void showProfilerFrame();
+
 	/**
 	 * @brief Reveals the memory viewer frame.
 	 */
@@ -200,6 +223,13 @@ public:
 	void sendCartridgeLoadedEvent();
 
 private:
+	/**
+	 * @brief Applies the options given on the command line to the core.
+	 * 
+	 * @return Returns false if an option could not be understood.
+	 */
+	bool parseCommandLine();
+
 	// A boolean indicating whether the emulator is currently running.
 	bool runningEmulator = true;
 
@@ -209,6 +239,7 @@ private:
 	
 	MainWindowFrame *mainWindow = nullptr;
 	CPUStateFrame *cpuStateFrame = nullptr;
+	ProfilerFrame *profilerFrame = nullptr;
 	MemoryViewerFrame *memoryViewerFrame = nullptr;
 	PaletteViewerFrame *paletteViewerFrame = nullptr;
 	TileViewerFrame *tileViewerFrame = nullptr;
@@ -12,6 +12,7 @@
 #include "wx/progdlg.h"
 #include <SDL.h>
 #include <vector>
+#include <atomic>
 
 #include "../../core/include/defines.h"
 #include "../../core/include/sdlController.h"
@@ -20,6 +21,15 @@
 class App;
 class Core;
 
+// Fast-forward speeds, as multiples of normal speed. Uncapped runs as many
+// frames as fit between two refreshes of the display.
+#define FAST_FORWARD_UNCAPPED 0
+#define DEFAULT_FAST_FORWARD_SPEED 4
+// The key which toggles fast-forward.
+#define FAST_FORWARD_KEY SDL_SCANCODE_TAB
+// How long, in milliseconds, the emulation speed is averaged over.
+#define SPEED_SAMPLE_INTERVAL 500
+
 /**
  * @brief The main thread for running the emulator. This class handles the 
  * running of the emulation core as well as rendering the main display.
@@ -61,8 +71,33 @@ public:
      */
     Uint64 updateAndGetFrameDelta();
 
+    /**
+     * @brief Turns fast-forward on or off. While on, frames are run at the
+     * fast-forward speed, only the last frame before each display refresh is
+     * shown and the audio is muted.
+     */
+    void setFastForward(bool state);
+    void toggleFastForward(){ setFastForward(!fastForwarding); }
+
+    /**
+     * @brief Sets the fast-forward speed as a multiple of normal speed, or
+     * `FAST_FORWARD_UNCAPPED` to run as fast as possible.
+     */
+    void setFastForwardSpeed(int speed){ fastForwardSpeed = speed; }
+
     // Simple Accessors.
     double getCurrentFPS(){return currentFPS;}
+    bool isFastForwarding(){return fastForwarding;}
+    int getFastForwardSpeed(){return fastForwardSpeed;}
+    /**
+     * @brief Returns the emulation speed as a multiple of normal speed.
+     */
+    double getEmulationSpeed(){return emulationSpeed;}
+    /**
+     * @brief Returns the share of CPU cycles replayed by the idle loop
+     * detector instead of interpreted, see `IdleLoopDetector`.
+     */
+    double getIdleSkipShare(){return idleSkipShare;}
 
     /**
      * @brief Adds a new rendering event to the event loop.
@@ -92,6 +127,28 @@ private:
     Uint64 targetFrameTime = FRAME_DELAY;
     double currentFPS = 0;
 
+    // Fast-forward state. The GUI thread may change these.
+    std::atomic<bool> fastForwarding{false};
+    std::atomic<int> fastForwardSpeed{DEFAULT_FAST_FORWARD_SPEED};
+    bool vsyncEnabled = true;
+
+    // Emulation speed calculation vars.
+    Uint64 speedSampleStartTime = 0;
+    uint64_t speedSampleStartFrame = 0;
+    double emulationSpeed = 0;
+    uint64_t speedSampleStartIdleCycles = 0;
+    double idleSkipShare = 0;
+
+    /**
+     * @brief Runs the core for everything shown in one displayed frame.
+     */
+    void runFrames();
+    /**
+     * @brief Updates `emulationSpeed` and `idleSkipShare` once a sample
+     * interval has passed.
+     */
+    void updateEmulationSpeed();
+
     // An array of additional render functions to call during the event loop.
     std::vector<voidFuncWithNoArguments> additionalRenderFunctions;
 };
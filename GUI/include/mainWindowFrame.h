@@ -50,6 +50,10 @@ public:
 	 * @brief The WxWidget menu's open CPU state view button event handler.
 	 */
 	void OnMenuOpenCPUStateViewButton(wxCommandEvent& event);
+	/**
+	 * @brief The WxWidget menu's open profiler view button event handler.
+	 */
+	void OnMenuOpenProfilerViewButton(wxCommandEvent& event);
 	/**
 	 * @brief The WxWidget menu's open memory viewer view button event handler.
 	 */
@@ -94,6 +98,19 @@ public:
 	 * @brief The WxWidget menu's open breakpoint manager button event handler.
 	 */
 	void OnMenuOpenBreakpointManagerViewButton(wxCommandEvent& event);
+	/**
+	 * @brief The WxWidget menu's record trace check item event handler.
+	 */
+	void OnMenuToggleTraceButton(wxCommandEvent& event);
+	/**
+	 * @brief The WxWidget menu's compress traces check item event handler.
+	 */
+	void OnMenuToggleTraceCompressionButton(wxCommandEvent& event);
+	/**
+	 * @brief The WxWidget menu's record AOT module check item event handler.
+	 * Unchecking it exports the module.
+	 */
+	void OnMenuToggleAOTRecordingButton(wxCommandEvent& event);
 
 	/**
 	 * @brief The event handler for the `EMULATOR_CORE_UPDATE_EVENT` wxWidget event.
@@ -113,6 +130,34 @@ public:
 	void handleTimes4SizeEvent(wxCommandEvent& event){pixelPerfectResizer(4);}
 	void handleTimes5SizeEvent(wxCommandEvent& event){pixelPerfectResizer(5);}
 
+	/**
+	 * @brief The WxWidget menu's fast-forward check item event handler.
+	 */
+	void OnMenuToggleFastForwardButton(wxCommandEvent& event);
+	/**
+	 * @brief Helper function to set the speed fast-forward runs at.
+	 * 
+	 * @param speed The speed as a multiple of normal speed, or `FAST_FORWARD_UNCAPPED`.
+	*/
+	void setFastForwardSpeed(int speed);
+
+	void handleFastForward2xEvent(wxCommandEvent& event){setFastForwardSpeed(2);}
+	void handleFastForward4xEvent(wxCommandEvent& event){setFastForwardSpeed(4);}
+	void handleFastForwardUncappedEvent(wxCommandEvent& event);
+	/**
+	 * @brief The WxWidget menu's threaded dispatch check item event handler.
+	 */
+	void OnMenuToggleThreadedDispatchButton(wxCommandEvent& event);
+	/**
+	 * @brief The WxWidget menu's JIT recompiler check item event handler.
+	 */
+	void OnMenuToggleJITButton(wxCommandEvent& event);
+
+	// RTC time source event callback functions.
+	void handleRTCHostClockEvent(wxCommandEvent& event);
+	void handleRTCEmulatedClockEvent(wxCommandEvent& event);
+	void handleRTCFixedTimeEvent(wxCommandEvent& event);
+
 	// Save and load state event callback functions.
 	void loadState1Event(wxCommandEvent& event);
 	void saveState1Event(wxCommandEvent& event);
@@ -146,7 +191,9 @@ private:
 	wxMenu* saveStateMenuLayout = nullptr;
 	wxMenu* toolsMenuLayout = nullptr;
 	wxMenu* displayMenuLayout = nullptr;
+	wxMenu* speedMenuLayout = nullptr;
 	wxMenu* debugMenuLayout = nullptr;
+	wxMenu* rtcMenuLayout = nullptr;
 };
 
 #endif
\ No newline at end of file
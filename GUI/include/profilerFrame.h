@@ -0,0 +1,76 @@
+/**
+ * The header declaration for the ProfilerFrame class.
+ */
+#ifndef PROFILERFRAME_H
+#define PROFILERFRAME_H
+
+#include <wx/wxprec.h>
+#include "wx/thread.h"
+#include "wx/dynarray.h"
+#include "wx/numdlg.h"
+#include "wx/progdlg.h"
+#include "wx/rawbmp.h"
+#include "wx/grid.h"
+
+class Core;
+class EmulationThread;
+
+// The number of hot spots listed.
+#define PROFILER_HOT_SPOT_ROWS 20
+// Core update events between refreshes of the hot spot table.
+#define PROFILER_REFRESH_INTERVAL 30
+
+/**
+ * The window GUI for controlling the execution profiler and displaying the
+ * addresses which take the most cycles.
+ */
+class ProfilerFrame : public wxFrame
+{
+public:
+	ProfilerFrame(Core *d_emuCore, EmulationThread* d_emuThread);
+	~ProfilerFrame();
+
+	/**
+	 * @brief The WxWidget's OnCloseWindow Event handler.
+	 */
+	void OnCloseWindow(wxCloseEvent& event);
+
+	/**
+	 * @brief The event handler for the `EMULATOR_CORE_UPDATE_EVENT` wxWidget event.
+	 */
+	void handleEmulatorCoreUpdateEvent(wxCommandEvent& event);
+
+	/**
+	 * @brief The event handler for the start/stop profiling button.
+	 */
+	void handleToggleProfilingButton(wxCommandEvent& event);
+	/**
+	 * @brief The event handler for the reset profile button.
+	 */
+	void handleResetButton(wxCommandEvent& event);
+	/**
+	 * @brief The event handler for the save report button.
+	 */
+	void handleSaveButton(wxCommandEvent& event);
+
+private:
+	wxDECLARE_EVENT_TABLE();
+
+	Core *emuCore = nullptr;
+	EmulationThread* emuThread = nullptr;
+
+	// Counts the update events since the table was last refreshed.
+	int eventsSinceRefresh = 0;
+
+	/**
+	 * @brief Refills the hot spot table from the current profile.
+	 */
+	void refreshHotSpots();
+
+	// WxWidget elements.
+	wxButton* toggleProfilingButton = nullptr;
+	wxStaticText* totalCyclesLabel = nullptr;
+	wxGrid* hotSpotGrid = nullptr;
+};
+
+#endif
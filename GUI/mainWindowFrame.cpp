@@ -47,6 +47,7 @@ MainWindowFrame::MainWindowFrame(Core *d_emuCore, App* d_appContext ) : wxFrame(
 	toolsMenuLayout = new wxMenu();
 	toolsMenuLayout->Append(wxMenuIDs::OPEN_CARTRIDGE_VIEWER_VIEW, _T("&Open Cartridge Info"));
 	toolsMenuLayout->Append(wxMenuIDs::OPEN_CPU_STATE_VIEW, _T("&Open CPU State View"));
+	toolsMenuLayout->Append(wxMenuIDs::OPEN_PROFILER_VIEW, _T("&Open Profiler"));
 	toolsMenuLayout->Append(wxMenuIDs::OPEN_MEMORY_VIEWER_VIEW, _T("&Open Memory Viewer"));
 	toolsMenuLayout->Append(wxMenuIDs::OPEN_PALETTE_VIEWER_VIEW, _T("&Open Palette Viewer"));
 	toolsMenuLayout->Append(wxMenuIDs::OPEN_TILE_VIEWER_VIEW, _T("&Open Tile Viewer"));
@@ -70,6 +71,21 @@ MainWindowFrame::MainWindowFrame(Core *d_emuCore, App* d_appContext ) : wxFrame(
 	}
 	menuBar->Append(displayMenuLayout, _T("&Display"));
 
+	// Speed Menu.
+	speedMenuLayout = new wxMenu();
+	speedMenuLayout->AppendCheckItem(wxMenuIDs::TOGGLE_FAST_FORWARD_MENU, _T("&Fast Forward (Tab)"));
+	speedMenuLayout->AppendSeparator();
+	speedMenuLayout->AppendRadioItem(wxMenuIDs::FAST_FORWARD_SPEED_2, _T("&x2"));
+	speedMenuLayout->AppendRadioItem(wxMenuIDs::FAST_FORWARD_SPEED_4, _T("&x4"));
+	speedMenuLayout->AppendRadioItem(wxMenuIDs::FAST_FORWARD_SPEED_UNCAPPED, _T("&Uncapped"));
+	speedMenuLayout->Check(wxMenuIDs::FAST_FORWARD_SPEED_4, true);
+	speedMenuLayout->AppendSeparator();
+	speedMenuLayout->AppendCheckItem(wxMenuIDs::TOGGLE_THREADED_DISPATCH_MENU, _T("&Threaded Dispatch"));
+	speedMenuLayout->Check(wxMenuIDs::TOGGLE_THREADED_DISPATCH_MENU, CPU_DEFAULT_DISPATCH_MODE == DISPATCH_THREADED);
+	speedMenuLayout->AppendCheckItem(wxMenuIDs::TOGGLE_JIT_MENU, _T("&JIT Recompiler"));
+	speedMenuLayout->Check(wxMenuIDs::TOGGLE_JIT_MENU, emuCore->getCPU()->isJITEnabled());
+	menuBar->Append(speedMenuLayout, _T("&Speed"));
+
 	// Debug Menu.
 	debugMenuLayout = new wxMenu();
 	debugMenuLayout->Append(wxMenuIDs::CONTINUE_EMULATION_MENU, _T("&Continue\tF9"));
@@ -78,6 +94,19 @@ MainWindowFrame::MainWindowFrame(Core *d_emuCore, App* d_appContext ) : wxFrame(
 	debugMenuLayout->Append(wxMenuIDs::STEP_CPU_MENU, _T("&Step CPU\tF7"));
 	debugMenuLayout->AppendSeparator();
 	debugMenuLayout->Append(wxMenuIDs::OPEN_BREAKPOINT_MANAGER, _T("&Breakpoints\tCtrl+B"));
+	debugMenuLayout->AppendSeparator();
+	debugMenuLayout->AppendCheckItem(wxMenuIDs::TOGGLE_TRACE_MENU, _T("&Record Trace"));
+	debugMenuLayout->AppendCheckItem(wxMenuIDs::TOGGLE_TRACE_COMPRESSION_MENU, _T("&Compress Traces"));
+	debugMenuLayout->Check(wxMenuIDs::TOGGLE_TRACE_COMPRESSION_MENU, true);
+	debugMenuLayout->AppendCheckItem(wxMenuIDs::TOGGLE_AOT_RECORDING_MENU, _T("Record &AOT Module"));
+	debugMenuLayout->AppendSeparator();
+	// The time MBC3's real-time clock counts, see `RTCTimeSources`.
+	rtcMenuLayout = new wxMenu();
+	rtcMenuLayout->AppendRadioItem(wxMenuIDs::RTC_HOST_CLOCK_MENU, _T("&Host Clock"));
+	rtcMenuLayout->AppendRadioItem(wxMenuIDs::RTC_EMULATED_CLOCK_MENU, _T("&Emulated Cycles"));
+	rtcMenuLayout->AppendRadioItem(wxMenuIDs::RTC_FIXED_TIME_MENU, _T("&Frozen"));
+	rtcMenuLayout->Check(wxMenuIDs::RTC_HOST_CLOCK_MENU, true);
+	debugMenuLayout->AppendSubMenu(rtcMenuLayout, _T("&RTC Time Source"));
 	menuBar->Append(debugMenuLayout, _T("&Debug"));
 
 	// Render the top menu bar.
@@ -124,8 +153,14 @@ void MainWindowFrame::handleEmulatorCoreUpdateEvent(wxCommandEvent& event){
 		cartName = " - ";
 		cartName += cartridge->getROMName();
 	}
-	// Change the title to reflect the current FPS and loaded title.
-	this->SetTitle(std::string(APP_TITLE) + cartName + " - " + std::to_string(emuThread->getCurrentFPS()));
+	// Change the title to reflect the current FPS, emulation speed, idle cycles skipped and loaded title.
+	std::string speed = std::to_string((int)(emuThread->getEmulationSpeed()*100 + 0.5)) + "%";
+	std::string idleSkipped = std::to_string((int)(emuThread->getIdleSkipShare()*100 + 0.5)) + "% idle skipped";
+	this->SetTitle(std::string(APP_TITLE) + cartName + " - " + std::to_string(emuThread->getCurrentFPS()) + " - " + speed + " - " + idleSkipped);
+	// Fast-forward can also be toggled from its key.
+	speedMenuLayout->Check(wxMenuIDs::TOGGLE_FAST_FORWARD_MENU, emuThread->isFastForwarding());
+	// Tracing stops whenever the cartridge changes.
+	debugMenuLayout->Check(wxMenuIDs::TOGGLE_TRACE_MENU, emuCore->isTracing());
 }
 
 void MainWindowFrame::OnCloseWindow(wxCloseEvent& event){
@@ -166,6 +201,9 @@ void MainWindowFrame::OnMenuResetGameBoyButton(wxCommandEvent& event){
 void MainWindowFrame::OnMenuOpenCPUStateViewButton(wxCommandEvent& event){
 	appContext->showCPUStateFrame();
 }
+void MainWindowFrame::OnMenuOpenProfilerViewButton(wxCommandEvent& event){
+	appContext->showProfilerFrame();
+}
 void MainWindowFrame::OnMenuOpenMemoryViewerViewButton(wxCommandEvent& event){
 	appContext->showMemoryViewerFrame();
 }
@@ -187,6 +225,18 @@ void MainWindowFrame::OnMenuOpenCartridgeViewerViewButton(wxCommandEvent& event)
 void MainWindowFrame::OnMenuOpenBreakpointManagerViewButton(wxCommandEvent& event){
 	appContext->showBreakpointManagerFrame();
 }
+void MainWindowFrame::OnMenuToggleTraceButton(wxCommandEvent& event){
+	emuCore->setTracing(event.IsChecked());
+	debugMenuLayout->Check(wxMenuIDs::TOGGLE_TRACE_MENU, emuCore->isTracing());
+}
+void MainWindowFrame::OnMenuToggleTraceCompressionButton(wxCommandEvent& event){
+	emuCore->setTraceCompression(event.IsChecked());
+}
+void MainWindowFrame::OnMenuToggleAOTRecordingButton(wxCommandEvent& event){
+	emuCore->setAOTRecording(event.IsChecked());
+	// The module covers everything run while recording.
+	if(!event.IsChecked()) emuCore->exportAOTModule();
+}
 void MainWindowFrame::OnMenuPauseButton(wxCommandEvent& event){
 	emuCore->pauseEmulatorExecution();
 }
@@ -199,5 +249,30 @@ void MainWindowFrame::OnMenuStepFrameButton(wxCommandEvent& event){
 void MainWindowFrame::OnMenuStepCPUButton(wxCommandEvent& event){
 	emuCore->stepNextInstuctionButton();
 }
+void MainWindowFrame::OnMenuToggleFastForwardButton(wxCommandEvent& event){
+	emuThread->setFastForward(event.IsChecked());
+}
+void MainWindowFrame::setFastForwardSpeed(int speed){
+	emuThread->setFastForwardSpeed(speed);
+}
+void MainWindowFrame::handleFastForwardUncappedEvent(wxCommandEvent& event){
+	setFastForwardSpeed(FAST_FORWARD_UNCAPPED);
+}
+void MainWindowFrame::OnMenuToggleThreadedDispatchButton(wxCommandEvent& event){
+	emuCore->setDispatchMode(event.IsChecked() ? DISPATCH_THREADED : DISPATCH_TABLE);
+}
+void MainWindowFrame::OnMenuToggleJITButton(wxCommandEvent& event){
+	emuCore->setJITEnabled(event.IsChecked());
+}
+void MainWindowFrame::handleRTCHostClockEvent(wxCommandEvent& event){
+	emuCore->setRTCTimeSource(RTC_HOST_CLOCK);
+}
+void MainWindowFrame::handleRTCEmulatedClockEvent(wxCommandEvent& event){
+	emuCore->setRTCTimeSource(RTC_EMULATED_CLOCK);
+}
+void MainWindowFrame::handleRTCFixedTimeEvent(wxCommandEvent& event){
+	// Any fixed time stops the clock at its current value.
+	emuCore->setRTCTimeSource(RTC_FIXED_TIME);
+}
 void MainWindowFrame::loadState1Event(wxCommandEvent& event){emuCore->loadState(1);}
 void MainWindowFrame::saveState1Event(wxCommandEvent& event){emuCore->saveState(1);}
\ No newline at end of file
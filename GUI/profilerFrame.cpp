@@ -0,0 +1,156 @@
+/**
+ * The implementation of the ProfilerFrame class.
+ */
+#include "include\profilerFrame.h"
+#include "include\emulationThread.h"
+#include "..\core\include\core.h"
+#include "..\core\include\profiler.h"
+#include "..\core\include\defines.h"
+#include <iostream>
+#include <string>
+
+// Enables debug cout statements for this file.
+#define ENABLE_DEBUG_PRINTS false
+
+ProfilerFrame::ProfilerFrame(Core *d_emuCore, EmulationThread *d_emuThread) : wxFrame(NULL, wxID_ANY, PROFILER_DISPLAY_TITLE, wxDefaultPosition, wxSize(PROFILER_DISPLAY_WIDTH, PROFILER_DISPLAY_HEIGHT), wxDEFAULT_FRAME_STYLE & ~wxRESIZE_BORDER)
+{
+    if (ENABLE_DEBUG_PRINTS)
+        std::cout << "Starting: Profiler Frame" << std::endl;
+
+    // Save passed pointers.
+    emuCore = d_emuCore;
+    emuThread = d_emuThread;
+
+    SetBackgroundColour(wxColour(255,255,255));
+    wxFont guiFont = wxFont(11, wxFONTFAMILY_DEFAULT, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL, false);
+    wxFont categoryLabelFont = wxFont(11, wxFONTFAMILY_DEFAULT, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_BOLD, false);
+
+    // Create sizers.
+    wxBoxSizer* parentSizer = new wxBoxSizer(wxVERTICAL);
+    wxBoxSizer* controlPanelSizer = new wxBoxSizer(wxHORIZONTAL);
+
+    // Control panel elements.
+    toggleProfilingButton = new wxButton(this, wxID_ANY, "Start", wxDefaultPosition, wxDefaultSize);
+    toggleProfilingButton->SetFont(guiFont);
+    toggleProfilingButton->Bind(wxEVT_BUTTON, &ProfilerFrame::handleToggleProfilingButton, this);
+    controlPanelSizer->Add(toggleProfilingButton, 0, wxEXPAND);
+    wxButton* resetButton = new wxButton(this, wxID_ANY, "Reset", wxDefaultPosition, wxDefaultSize);
+    resetButton->SetFont(guiFont);
+    resetButton->Bind(wxEVT_BUTTON, &ProfilerFrame::handleResetButton, this);
+    controlPanelSizer->Add(resetButton, 0, wxEXPAND);
+    wxButton* saveButton = new wxButton(this, wxID_ANY, "Save Report", wxDefaultPosition, wxDefaultSize);
+    saveButton->SetFont(guiFont);
+    saveButton->SetToolTip("Writes CSV and JSON reports into the profiles directory");
+    saveButton->Bind(wxEVT_BUTTON, &ProfilerFrame::handleSaveButton, this);
+    controlPanelSizer->Add(saveButton, 0, wxEXPAND);
+    totalCyclesLabel = new wxStaticText(this, wxID_ANY, "Cycles: 0");
+    totalCyclesLabel->SetFont(guiFont);
+    controlPanelSizer->Add(totalCyclesLabel, 0, wxEXPAND | wxTOP | wxLEFT, 6);
+
+    // Create the hot spot grid and set the high-level styling.
+    hotSpotGrid = new wxGrid(this, wxID_ANY, wxDefaultPosition, wxSize(PROFILER_DISPLAY_WIDTH - 15, -1));
+    hotSpotGrid->CreateGrid(PROFILER_HOT_SPOT_ROWS + 1, 6);
+    // Make the grid read-only.
+    hotSpotGrid->EnableDragGridSize(false);
+    hotSpotGrid->EnableEditing(false);
+    // Disable column and row labels.
+    hotSpotGrid->HideColLabels();
+    hotSpotGrid->HideRowLabels();
+
+    // Add column labels.
+    const char* columnLabels[] = {"Bank", "PC", "Instruction", "Executions", "Cycles", "%"};
+    int columnSizes[] = {50, 70, 120, 100, 100, 55};
+    for (int colIndex = 0; colIndex < 6; colIndex++)
+    {
+        hotSpotGrid->SetColSize(colIndex, columnSizes[colIndex]);
+        hotSpotGrid->SetCellValue(0, colIndex, columnLabels[colIndex]);
+        hotSpotGrid->SetCellFont(0, colIndex, categoryLabelFont);
+        hotSpotGrid->SetCellAlignment(0, colIndex, wxALIGN_CENTRE, wxALIGN_TOP);
+        hotSpotGrid->SetCellBackgroundColour(0, colIndex, *wxLIGHT_GREY);
+        for (int rowIndex = 1; rowIndex <= PROFILER_HOT_SPOT_ROWS; rowIndex++)
+        {
+            hotSpotGrid->SetCellFont(rowIndex, colIndex, guiFont);
+        }
+    }
+
+    // Format the frame.
+    parentSizer->Add(controlPanelSizer, 0, wxEXPAND | wxALL, 5);
+    parentSizer->Add(hotSpotGrid, 1, wxEXPAND);
+    SetSizer(parentSizer);
+}
+
+ProfilerFrame::~ProfilerFrame()
+{
+    if (ENABLE_DEBUG_PRINTS)
+        std::cout << "Exiting: Profiler Frame" << std::endl;
+}
+
+void ProfilerFrame::refreshHotSpots()
+{
+    uint64_t totalCycles = 0;
+    std::vector<ProfileHotSpot> hotSpots = emuCore->getProfileHotSpots(PROFILER_HOT_SPOT_ROWS, &totalCycles);
+
+    totalCyclesLabel->SetLabel("Cycles: " + std::to_string(totalCycles));
+
+    // Create a buffer to convert word values into hex notation strings.
+    char valueBuffer[7];
+    for (int rowIndex = 0; rowIndex < PROFILER_HOT_SPOT_ROWS; rowIndex++)
+    {
+        int gridRow = rowIndex + 1;
+        if (rowIndex >= (int)hotSpots.size())
+        {
+            for (int colIndex = 0; colIndex < 6; colIndex++) hotSpotGrid->SetCellValue(gridRow, colIndex, "");
+            continue;
+        }
+
+        const ProfileHotSpot& hotSpot = hotSpots[rowIndex];
+        hotSpotGrid->SetCellValue(gridRow, 0, hotSpot.bank == PROFILER_NO_BANK ? "RAM" : std::to_string(hotSpot.bank));
+        convertWordToHexNotation(hotSpot.pc, valueBuffer);
+        hotSpotGrid->SetCellValue(gridRow, 1, valueBuffer);
+        hotSpotGrid->SetCellValue(gridRow, 2, Profiler::instructionName(hotSpot.opcode, hotSpot.cbOpcode));
+        hotSpotGrid->SetCellValue(gridRow, 3, std::to_string(hotSpot.executions));
+        hotSpotGrid->SetCellValue(gridRow, 4, std::to_string(hotSpot.cycles));
+        hotSpotGrid->SetCellValue(gridRow, 5, wxString::Format("%.2f", totalCycles ? 100.0 * hotSpot.cycles / totalCycles : 0.0));
+    }
+
+    // Force the grid to update.
+    hotSpotGrid->Refresh();
+}
+
+// Event Handlers.
+
+void ProfilerFrame::handleEmulatorCoreUpdateEvent(wxCommandEvent &event)
+{
+    // Return early if not active.
+    if (!this->IsShown() || !emuCore->isProfilingEnabled())
+        return;
+
+    // Collecting the hot spots walks every profiled address, don't do it every frame.
+    if (++eventsSinceRefresh < PROFILER_REFRESH_INTERVAL)
+        return;
+    eventsSinceRefresh = 0;
+    refreshHotSpots();
+}
+
+void ProfilerFrame::handleToggleProfilingButton(wxCommandEvent &event)
+{
+    emuCore->setProfilingEnabled(!emuCore->isProfilingEnabled());
+    toggleProfilingButton->SetLabel(emuCore->isProfilingEnabled() ? "Stop" : "Start");
+    refreshHotSpots();
+}
+
+void ProfilerFrame::handleResetButton(wxCommandEvent &event)
+{
+    emuCore->resetProfile();
+    refreshHotSpots();
+}
+
+void ProfilerFrame::handleSaveButton(wxCommandEvent &event)
+{
+    emuCore->saveProfile();
+}
+
+void ProfilerFrame::OnCloseWindow(wxCloseEvent &event)
+{
+    this->Hide();
+}
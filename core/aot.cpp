@@ -0,0 +1,416 @@
+/**
+ * AOT class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\aot.h"
+#include "include\cpu.h"
+#include "include\cartridge.h"
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <cstddef>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+// A basic block discovered while walking the cartridge.
+struct ExportedBlock{
+    word bank;
+    word pc;
+    cycles cycleCount = 0;
+    // The instructions of the block along with the PC following each one.
+    std::vector<std::pair<DecodedInstruction, word>> instructions;
+};
+
+/**
+ * @brief Decodes the instruction at (`bank`, `pc`) straight from the ROM image.
+ * Returns false if its operands cross into the next bank.
+ */
+static bool decodeFromROM(Cartridge* cartridge, word bank, word pc, DecodedInstruction& decoded){
+    uint32_t bankStart = bank*ROM_BANK_SIZE;
+    word offset = pc & (ROM_BANK_SIZE - 1);
+
+    decoded.opcode = cartridge->readROMByte(bankStart + offset);
+    decoded.length = INSTRUCTION_SET[decoded.opcode].length;
+    if(offset + decoded.length > ROM_BANK_SIZE) return false;
+
+    decoded.parsedData = 0;
+    if(decoded.length == 2) decoded.parsedData = cartridge->readROMByte(bankStart + offset + 1);
+    else if(decoded.length == 3) decoded.parsedData = cartridge->readROMByte(bankStart + offset + 1) | (cartridge->readROMByte(bankStart + offset + 2) << 8);
+    return true;
+}
+
+AOT::~AOT(){
+    unload();
+}
+
+// Modules are handed the register file as `AOTRegisters`.
+static_assert(sizeof(AOTRegisters) == sizeof(CPU_State), "AOTRegisters does not match CPU_State");
+static_assert(offsetof(AOTRegisters, PC) == offsetof(CPU_State, PC), "AOTRegisters does not match CPU_State");
+static_assert(offsetof(AOTRegisters, SP) == offsetof(CPU_State, SP), "AOTRegisters does not match CPU_State");
+
+AOTCPUState AOT::enterBlock(CPU* cpu){
+    cpu->materializeFlags();
+    return {reinterpret_cast<AOTRegisters*>(&cpu->regs), &cpu->parsedData};
+}
+
+void AOT::materializeFlags(CPU* cpu){
+    cpu->materializeFlags();
+}
+
+// The 8 bit registers as the opcodes number them, 6 is (HL).
+static const char* const REGISTER_NAMES[8] = {"B", "C", "D", "E", "H", "L", nullptr, "A"};
+// The 16 bit registers of INC rr, DEC rr and LD rr,d16.
+static const char* const REGISTER_PAIR_NAMES[4] = {"BC", "DE", "HL", "SP"};
+// The conditions of JR cc and JP cc, as expressions on the registers `r`.
+static const char* const CONDITIONS[4] = {"!(r->F & AOT_FLAG_Z)", "(r->F & AOT_FLAG_Z)", "!(r->F & AOT_FLAG_C)", "(r->F & AOT_FLAG_C)"};
+
+/**
+ * @brief Writes the C++ for `decoded` working on the registers `r`, if it is
+ * one which is written out inline. Returns false if the handler has to run.
+ * `touchesFlags` is set if the code reads or writes F, `setsPC` if it ends
+ * the block by setting PC.
+ */
+static bool emitInline(std::ostream& source, const DecodedInstruction& decoded, word nextPC, bool& touchesFlags, bool& setsPC){
+    byte opcode = decoded.opcode;
+    touchesFlags = false;
+    setsPC = false;
+    std::ostringstream line;
+    line << std::hex << std::uppercase << std::setfill('0');
+
+    // Operand of the 8 bit ALU operations on A, a register or the immediate.
+    auto aluOperand = [&](byte index) -> std::string {
+        if(opcode >= 0xC0){
+            std::ostringstream immediate;
+            immediate << std::hex << std::uppercase << "0x" << std::setw(2) << std::setfill('0') << (decoded.parsedData & 0xFF);
+            return immediate.str();
+        }
+        return std::string("r->") + REGISTER_NAMES[index];
+    };
+
+    if(opcode == NOP){
+    // LD r,r'
+    } else if(opcode >= 0x40 && opcode <= 0x7F && opcode != HALT){
+        if(REGISTER_NAMES[(opcode >> 3) & 7] == nullptr || REGISTER_NAMES[opcode & 7] == nullptr) return false;
+        line << "r->" << REGISTER_NAMES[(opcode >> 3) & 7] << " = r->" << REGISTER_NAMES[opcode & 7] << ";";
+    // ALU A,r and ALU A,d8
+    } else if((opcode >= 0x80 && opcode <= 0xBF) || (opcode >= 0xC0 && (opcode & 0x07) == 0x06)){
+        if(opcode < 0xC0 && REGISTER_NAMES[opcode & 7] == nullptr) return false;
+        std::string operand = aluOperand(opcode & 7);
+        switch ((opcode >> 3) & 7)
+        {
+        case 0: line << "aotAdd(r, " << operand << ", false);"; break;
+        case 1: line << "aotAdd(r, " << operand << ", r->F & AOT_FLAG_C);"; break;
+        case 2: line << "aotSub(r, " << operand << ", false, true);"; break;
+        case 3: line << "aotSub(r, " << operand << ", r->F & AOT_FLAG_C, true);"; break;
+        case 4: line << "aotAnd(r, " << operand << ");"; break;
+        case 5: line << "aotXor(r, " << operand << ");"; break;
+        case 6: line << "aotOr(r, " << operand << ");"; break;
+        default: line << "aotSub(r, " << operand << ", false, false);"; break;
+        }
+        touchesFlags = true;
+    } else if(opcode < 0x40){
+        const char* reg = REGISTER_NAMES[(opcode >> 3) & 7];
+        const char* pair = REGISTER_PAIR_NAMES[opcode >> 4];
+        switch (opcode & 0x0F)
+        {
+        // LD r,d8, INC r and DEC r
+        case 0x04: case 0x0C:
+            if(reg == nullptr) return false;
+            line << "aotInc(r, r->" << reg << ");";
+            touchesFlags = true;
+            break;
+        case 0x05: case 0x0D:
+            if(reg == nullptr) return false;
+            line << "aotDec(r, r->" << reg << ");";
+            touchesFlags = true;
+            break;
+        case 0x06: case 0x0E:
+            if(reg == nullptr) return false;
+            line << "r->" << reg << " = 0x" << std::setw(2) << (decoded.parsedData & 0xFF) << ";";
+            break;
+        // LD rr,d16, INC rr and DEC rr
+        case 0x01:
+            line << "r->" << pair << " = 0x" << std::setw(4) << decoded.parsedData << ";";
+            break;
+        case 0x03:
+            line << "r->" << pair << "++;";
+            break;
+        case 0x0B:
+            line << "r->" << pair << "--;";
+            break;
+        default:
+            // JR r8 and JR cc,r8
+            if(opcode == JR_r8 || opcode == JR_NZ_r8 || opcode == JR_Z_r8 || opcode == JR_NC_r8 || opcode == JR_C_r8){
+                word target = nextPC + (int8_t)decoded.parsedData;
+                if(opcode == JR_r8) line << "r->PC = 0x" << std::setw(4) << target << ";";
+                else {
+                    line << "r->PC = " << CONDITIONS[(opcode >> 3) & 3] << " ? 0x" << std::setw(4) << target << " : 0x" << std::setw(4) << nextPC << ";";
+                    touchesFlags = true;
+                }
+                setsPC = true;
+                break;
+            }
+            return false;
+        }
+    // JP a16, JP cc,a16 and JP HL
+    } else if(opcode == JP_a16){
+        line << "r->PC = 0x" << std::setw(4) << decoded.parsedData << ";";
+        setsPC = true;
+    } else if(opcode == JP_NZ_a16 || opcode == JP_Z_a16 || opcode == JP_NC_a16 || opcode == JP_C_a16){
+        line << "r->PC = " << CONDITIONS[(opcode >> 3) & 3] << " ? 0x" << std::setw(4) << decoded.parsedData << " : 0x" << std::setw(4) << nextPC << ";";
+        touchesFlags = true;
+        setsPC = true;
+    } else if(opcode == JP_HL){
+        line << "r->PC = r->HL;";
+        setsPC = true;
+    } else {
+        return false;
+    }
+
+    if(!line.str().empty()) line << " ";
+    source << "    " << line.str() << "// " << INSTRUCTION_SET[opcode].opcode << "\n";
+    return true;
+}
+
+bool AOT::saveBlockLog(const std::string& logPath){
+    // Keep the entries of earlier sessions.
+    std::set<uint32_t> merged = blockLog;
+    std::ifstream existing(logPath);
+    uint32_t bank, pc;
+    while(existing >> std::hex >> bank >> pc) merged.insert((bank << 16) | pc);
+    existing.close();
+
+    std::ofstream logFile(logPath);
+    if(!logFile.is_open()){
+        std::cout << "ERROR: Could not write the AOT execution log \"" << logPath << "\"!" << std::endl;
+        return false;
+    }
+    logFile << std::hex;
+    for(uint32_t entry : merged) logFile << (entry >> 16) << " " << (entry & 0xFFFF) << "\n";
+    return true;
+}
+
+bool AOT::exportSource(Cartridge* cartridge, const std::string& logPath, const std::string& sourcePath){
+    if(!cartridge->isROMLoaded()) return false;
+    word bankCount = cartridge->getROMSize() / ROM_BANK_SIZE;
+
+    // Blocks to visit, packed as (bank << 16) | pc.
+    std::set<uint32_t> visited;
+    std::vector<uint32_t> worklist;
+    auto enqueue = [&](word bank, word pc){
+        if(pc > ROMBANKN_END) return;
+        if(pc <= ROMBANK0_END) bank = 0;
+        if(bank >= bankCount) return;
+        uint32_t key = (bank << 16) | pc;
+        if(visited.insert(key).second) worklist.push_back(key);
+    };
+
+    // Seed with the entry point, the RST and interrupt vectors...
+    enqueue(0, 0x0100);
+    for(word vector = 0x00; vector <= 0x38; vector += 0x08) enqueue(0, vector);
+    for(word vector = 0x40; vector <= 0x60; vector += 0x08) enqueue(0, vector);
+    // ...then every block start found in the execution log.
+    std::ifstream logFile(logPath);
+    uint32_t logBank, logPC;
+    while(logFile >> std::hex >> logBank >> logPC) enqueue(logBank, logPC);
+    logFile.close();
+
+    std::map<uint32_t, ExportedBlock> blocks;
+    while(!worklist.empty()){
+        uint32_t key = worklist.back();
+        worklist.pop_back();
+
+        ExportedBlock block;
+        block.bank = key >> 16;
+        block.pc = key & 0xFFFF;
+        // Code in 4000-7FFF can only be followed into the same bank, or into
+        // bank 1 for cartridges without banking. Unknown banks are dropped by
+        // `enqueue` as out of range.
+        auto targetBank = [&](word target){
+            if(target <= ROMBANK0_END) return (word)0;
+            if(block.pc >= ROMBANKN_START) return block.bank;
+            return bankCount == 2 ? (word)1 : bankCount;
+        };
+
+        word pc = block.pc;
+        while((pc & 0xC000) == (block.pc & 0xC000)){
+            // Split long blocks, the rest starts a new one.
+            if(block.instructions.size() == JIT_MAX_BLOCK_INSTRUCTIONS){
+                enqueue(block.bank, pc);
+                break;
+            }
+
+            DecodedInstruction decoded;
+            if(!decodeFromROM(cartridge, block.bank, pc, decoded)) break;
+            word nextPC = pc + decoded.length;
+
+            // The interpreter runs this one, a new block starts right after it.
+            // Generated blocks have no page table checks, so accesses through
+            // BC, DE or HL are left to the interpreter as well.
+            if(!JIT::isCompilable(decoded) || JIT::getRegisterAccess(decoded) != JIT_ACCESS_NONE){
+                enqueue(block.bank, nextPC);
+                break;
+            }
+
+            block.instructions.push_back({decoded, nextPC});
+            block.cycleCount += INSTRUCTION_SET[decoded.opcode].cycleCount;
+            pc = nextPC;
+
+            if(!JIT::endsBlock(decoded)) continue;
+
+            // Follow every statically known successor.
+            switch (decoded.opcode)
+            {
+            case JR_r8:
+                enqueue(block.bank, nextPC + (int8_t)decoded.parsedData);
+                break;
+            case JR_NZ_r8: case JR_Z_r8: case JR_NC_r8: case JR_C_r8:
+                enqueue(block.bank, nextPC + (int8_t)decoded.parsedData);
+                enqueue(block.bank, nextPC);
+                break;
+            case JP_a16:
+                enqueue(targetBank(decoded.parsedData), decoded.parsedData);
+                break;
+            case JP_NZ_a16: case JP_Z_a16: case JP_NC_a16: case JP_C_a16:
+            case CALL_a16: case CALL_NZ_a16: case CALL_Z_a16: case CALL_NC_a16: case CALL_C_a16:
+                enqueue(targetBank(decoded.parsedData), decoded.parsedData);
+                enqueue(block.bank, nextPC);
+                break;
+            case RET_NZ: case RET_Z: case RET_NC: case RET_C:
+            case RST_00H: case RST_08H: case RST_10H: case RST_18H:
+            case RST_20H: case RST_28H: case RST_30H: case RST_38H:
+                enqueue(block.bank, nextPC);
+                break;
+            case LD_ma16_A: case LD_mA16_SP:
+                // A store into ROM, the code after it may run from another bank.
+                enqueue(block.bank, nextPC);
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+
+        if(!block.instructions.empty()) blocks[key] = block;
+    }
+
+    // Emit the module.
+    std::ofstream source(sourcePath);
+    if(!source.is_open()){
+        std::cout << "ERROR: Could not write the AOT module source \"" << sourcePath << "\"!" << std::endl;
+        return false;
+    }
+    word checksum = (cartridge->readROMByte(GLOBAL_CHECKSUM_START) << 8) | cartridge->readROMByte(GLOBAL_CHECKSUM_START + 1);
+
+    source << std::hex << std::uppercase << std::setfill('0');
+    source << "// Ahead-of-time compiled blocks for \"" << cartridge->getROMName() << "\". Generated by gb-gbc_emu, do not edit.\n";
+    source << "// Build with scripts/buildAOTModule.bat (or .sh) " << std::filesystem::path(sourcePath).stem().string() << "\n";
+    source << "#include \"aotModule.h\"\n\n";
+    source << "static const AOTRuntime* rt = nullptr;\n\n";
+    source << "static void bind(const AOTRuntime* d_runtime){ rt = d_runtime; }\n\n";
+
+    for(const auto& [key, block] : blocks){
+        source << "static void block_" << std::setw(8) << key << "(CPU* cpu){\n";
+        source << "    AOTCPUState state = rt->enterBlock(cpu);\n";
+        source << "    AOTRegisters* r = state.regs;\n";
+        // Set once a handler may have left its flags pending.
+        bool flagsPending = false;
+        bool setsPC = false;
+        for(const auto& [decoded, nextPC] : block.instructions){
+            std::ostringstream code;
+            code << std::hex << std::uppercase << std::setfill('0');
+            bool touchesFlags;
+            if(emitInline(code, decoded, nextPC, touchesFlags, setsPC)){
+                if(touchesFlags && flagsPending) source << "    rt->materializeFlags(cpu);\n";
+                if(touchesFlags) flagsPending = false;
+                source << code.str();
+                continue;
+            }
+
+            // Handlers expect PC to point past the instruction and its immediates.
+            if(JIT::handlerReadsPC(decoded.opcode)) source << "    r->PC = 0x" << std::setw(4) << nextPC << ";";
+            else source << "   ";
+            if(decoded.length > 1) source << " *state.parsedData = 0x" << std::setw(4) << decoded.parsedData << ";";
+            source << " rt->handlers[0x" << std::setw(2) << (int)decoded.opcode << "](cpu); // " << INSTRUCTION_SET[decoded.opcode].opcode << "\n";
+            flagsPending = true;
+            setsPC = JIT::handlerReadsPC(decoded.opcode);
+        }
+        if(!setsPC) source << "    r->PC = 0x" << std::setw(4) << block.instructions.back().second << ";\n";
+        source << "}\n";
+    }
+
+    source << "\nstatic const AOTBlock blocks[] = {\n";
+    for(const auto& [key, block] : blocks){
+        source << "    {0x" << std::setw(4) << block.bank << ", 0x" << std::setw(4) << block.pc << ", " << std::dec << block.cycleCount
+               << std::hex << ", block_" << std::setw(8) << key << "},\n";
+    }
+    source << "};\n\n";
+    source << "static const AOTModule aotModule = {AOT_MODULE_VERSION, 0x" << std::setw(4) << checksum << ", "
+           << std::dec << blocks.size() << ", blocks, bind};\n\n";
+    source << "#ifdef _WIN32\n__declspec(dllexport)\n#endif\n";
+    source << "extern \"C\" const AOTModule* gbAOTModule(){ return &aotModule; }\n";
+
+    std::cout << "Exported " << std::dec << blocks.size() << " blocks to \"" << sourcePath << "\"." << std::endl;
+    return true;
+}
+
+bool AOT::load(const std::string& libraryPath, CPU* cpu, Cartridge* cartridge){
+    unload();
+    if(!std::filesystem::exists(libraryPath)) return false;
+
+    AOTModuleEntry entry = nullptr;
+#ifdef _WIN32
+    HMODULE handle = LoadLibraryA(libraryPath.c_str());
+    if(handle) entry = (AOTModuleEntry)GetProcAddress(handle, AOT_MODULE_SYMBOL);
+#else
+    void* handle = dlopen(libraryPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if(handle) entry = (AOTModuleEntry)dlsym(handle, AOT_MODULE_SYMBOL);
+#endif
+    if(handle == nullptr || entry == nullptr){
+        std::cout << "ERROR: Could not load the AOT module \"" << libraryPath << "\"!" << std::endl;
+        if(handle) {
+            library = (void*)handle;
+            unload();
+        }
+        return false;
+    }
+    library = (void*)handle;
+    module = entry();
+
+    // Refuse modules built for another ROM or emulator version.
+    word checksum = (cartridge->readROMByte(GLOBAL_CHECKSUM_START) << 8) | cartridge->readROMByte(GLOBAL_CHECKSUM_START + 1);
+    if(module == nullptr || module->version != AOT_MODULE_VERSION || module->romChecksum != checksum){
+        std::cout << "ERROR: The AOT module \"" << libraryPath << "\" does not match this ROM or emulator version!" << std::endl;
+        unload();
+        return false;
+    }
+
+    runtime.enterBlock = &AOT::enterBlock;
+    runtime.materializeFlags = &AOT::materializeFlags;
+    runtime.handlers = INSTRUCTION_HANDLERS;
+    module->bind(&runtime);
+    for(uint32_t i = 0; i < module->blockCount; i++){
+        const AOTBlock& block = module->blocks[i];
+        cpu->jit.installBlock(block.bank, block.pc, block.code, block.cycleCount);
+    }
+
+    std::cout << "Loaded " << module->blockCount << " AOT compiled blocks from \"" << libraryPath << "\"." << std::endl;
+    return true;
+}
+
+void AOT::unload(){
+    if(library == nullptr) return;
+#ifdef _WIN32
+    FreeLibrary((HMODULE)library);
+#else
+    dlclose(library);
+#endif
+    library = nullptr;
+    module = nullptr;
+}
@@ -3,6 +3,7 @@ The class implementation for the emulator's APU for audio.
 */
 #include "include/apu.h"
 #include "include/register.h"
+#include "include/memoryArena.h"
 #include <algorithm>
 #include <cmath>
 
@@ -17,23 +18,25 @@ APU::APU(){
     audioRegs[4] = &globalChannel;
 }
 
-bool APU::init(){
-    wavePatternRAM = new byte[WAVE_RAM_SIZE];
-    if (wavePatternRAM == nullptr)
-        return false;
-
-    audioData = new AudioChannelData[AUDIO_FRAMES_PER_BUFFER*BUFFER_SCALE];
-    if (audioData == nullptr)
+bool APU::init(MemoryArena& arena){
+    wavePatternRAM = arena.allocate<byte>(WAVE_RAM_SIZE);
+    audioData = arena.allocate<AudioChannelData>(AUDIO_FRAMES_PER_BUFFER*BUFFER_SCALE);
+    if (wavePatternRAM == nullptr || audioData == nullptr)
         return false;
 
     reset();
     return true;
 }
 
+size_t APU::arenaSize(){
+    return MemoryArena::blockSize<byte>(WAVE_RAM_SIZE)
+        + MemoryArena::blockSize<AudioChannelData>(AUDIO_FRAMES_PER_BUFFER*BUFFER_SCALE);
+}
+
 void APU::destroy(){
-    // Deallocates the data.
-    delete[] wavePatternRAM;
-    delete[] audioData;
+    // The arena owns the data, only forget it.
+    wavePatternRAM = nullptr;
+    audioData = nullptr;
 }
 
 void APU::reset(){
@@ -555,7 +558,20 @@ void APU::cycle(byte divAPUEvents){
     if(writeLocation == AUDIO_BUFFER_SIZE) writeLocation = 0;
 }
 
+void APU::advance(cycles numCycles){
+    if(!globalChannel.masterOn) return;
+    for(cycles i = 0; i < numCycles; i++) cycle(0);
+}
+
 AudioChannelData* APU::fetchAudioData(){
+    if(resyncPending.exchange(false)){
+        // Leave a buffer of audio to play so playback does not run into the write position.
+        uint32_t latency = AUDIO_FRAMES_PER_BUFFER;
+        uint32_t write = writeLocation;
+        if(write >= latency) readLocation = write - latency;
+        else readLocation = write + (AUDIO_BUFFER_SIZE) - latency;
+    }
+
     uint32_t offset = readLocation;
     // Increment the read postion for next time.
     readLocation++;
@@ -565,6 +581,10 @@ AudioChannelData* APU::fetchAudioData(){
     return audioData+offset;
 }
 
+void APU::resyncAudio(){
+    resyncPending = true;
+}
+
 void ChannelController::saveToState(byte*& writeBuffer){
     std::memcpy(writeBuffer, &cyclesCounter, sizeof(cycles)); writeBuffer+=sizeof(cycles);
 
@@ -0,0 +1,113 @@
+/**
+ * BatterySave class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\batterySave.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+void BatterySave::start(const std::string& d_filePath, byte* d_ram, uint32_t d_ramSize){
+    stop();
+    filePath = d_filePath;
+    ram = d_ram;
+    ramSize = d_ramSize;
+
+    // Load the RAM with the save file's contents, or create a save if there is none.
+    std::ifstream saveFile(filePath, std::ios::in | std::ios::binary);
+    bool hasSave = saveFile.is_open();
+    if(hasSave) saveFile.read((char*)d_ram, ramSize);
+    saveFile.close();
+    saved.assign(ram, ram + ramSize);
+    if(!hasSave) writeSaveFile();
+
+    running = true;
+    writer = std::thread(&BatterySave::flushPeriodically, this);
+}
+
+void BatterySave::stop(){
+    if(!writer.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+    }
+    wake.notify_all();
+    writer.join();
+
+    // Catch anything written since the last flush.
+    flush();
+    std::lock_guard<std::mutex> lock(saveMutex);
+    ram = nullptr;
+}
+
+void BatterySave::setFlushInterval(int milliseconds){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushInterval = milliseconds;
+    }
+    wake.notify_all();
+}
+
+void BatterySave::flushPeriodically(){
+    std::unique_lock<std::mutex> lock(mutex);
+    while(running){
+        wake.wait_for(lock, std::chrono::milliseconds(flushInterval));
+        if(!running) break;
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+void BatterySave::flush(){
+    std::lock_guard<std::mutex> lock(saveMutex);
+    if(!ram) return;
+    // The emulator keeps writing while this copies, a game saving at that
+    // moment is caught by the next flush.
+    if(std::memcmp(saved.data(), ram, ramSize) == 0) return;
+    std::memcpy(saved.data(), ram, ramSize);
+    writeSaveFile();
+}
+
+bool BatterySave::update(uint32_t offset, const byte* data, uint32_t length){
+    std::lock_guard<std::mutex> lock(saveMutex);
+    if(!ram || offset + length > ramSize) return false;
+    std::memcpy(ram + offset, data, length);
+    return true;
+}
+
+bool BatterySave::writeSaveFile(){
+    std::string tempPath = filePath + ".tmp";
+    FILE* tempFile = fopen(tempPath.c_str(), "wb");
+    if(!tempFile){
+        std::cout << "ERROR: Could not write the battery save \"" << tempPath << "\"!" << std::endl;
+        return false;
+    }
+    bool written = fwrite(saved.data(), 1, saved.size(), tempFile) == saved.size();
+    // Make sure the new save is on disk before it replaces the old one.
+    written = written && fflush(tempFile) == 0;
+#ifdef _WIN32
+    written = written && _commit(_fileno(tempFile)) == 0;
+#else
+    written = written && fsync(fileno(tempFile)) == 0;
+#endif
+    fclose(tempFile);
+
+    std::error_code error;
+    if(written) std::filesystem::rename(tempPath, filePath, error);
+    if(!written || error){
+        std::cout << "ERROR: Could not write the battery save \"" << filePath << "\"!" << std::endl;
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
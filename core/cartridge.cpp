@@ -19,34 +19,60 @@ void RTC::syncToCartridge(std::string cartridgeName){
 		.append(cartridgeName)
 		.append(".rtc");
 
-	// Try an open the RTC save.
-	clockFile.open(timerSaveFilePath, std::ios::in | std::ios::out | std::ios::binary);
-
-	// RTC file does not exist. Make a new one.
-	if (!clockFile.is_open()){
-		clockFile.close();
-		// Create a battery save directory if one does not exist.
-		if (!std::filesystem::is_directory(BAT_SAVE_SUB_DIR) || !std::filesystem::exists(BAT_SAVE_SUB_DIR)) {
-			std::filesystem::create_directory(BAT_SAVE_SUB_DIR);
-		}
-
-		// Create a new file. 
-		clockFile.open(timerSaveFilePath, std::ios::out | std::ios::binary);
-		saveClockToFile();
-	} else {
-		// Load the buffer with the save files contents.
-		loadClockFromFile();
+	// Create a battery save directory if one does not exist.
+	if (!std::filesystem::is_directory(BAT_SAVE_SUB_DIR) || !std::filesystem::exists(BAT_SAVE_SUB_DIR)) {
+		std::filesystem::create_directory(BAT_SAVE_SUB_DIR);
 	}
+
+	// A new clock starts counting from zero now. `clockSave` is stopped, so
+	// the buffer can be written directly.
+	lastSaved = currentTime();
+	valueSaved = 0;
+	packClock(clockData);
+	// Load the buffer with the save files contents, if there is one.
+	clockSave.start(timerSaveFilePath, clockData, RTC_SAVE_SIZE);
+	loadClock();
 }
 
-void RTC::latchClock(){
-	// Get current number of seconds. 
-	long long currTime = std::chrono::duration_cast<std::chrono::seconds>(
-		std::chrono::steady_clock::now().time_since_epoch()
+// The host's wall clock, unlike a steady clock it carries on across reboots.
+static long long hostTime(){
+	return std::chrono::duration_cast<std::chrono::seconds>(
+		std::chrono::system_clock::now().time_since_epoch()
 	).count();
+}
+
+long long RTC::currentTime(){
+	if(timeSource) return timeSource();
+	return hostTime();
+}
+
+void RTC::saveTimestamps(long long currTime){
+	byte timestamps[RTC_TIMESTAMPS_SIZE];
+	packTimestamps(timestamps, currTime);
+	clockSave.update(RTC_TIMESTAMPS_OFFSET, timestamps, RTC_TIMESTAMPS_SIZE);
+}
+
+void RTC::packTimestamps(byte* buffer, long long currTime){
+	// The save is always against the wall clock, so it means the same to any time source.
+	long long value = clockValue(currTime);
+	long long wallTime = hostTime();
+	byte* writeBuffer = buffer;
+	std::memcpy(writeBuffer, &wallTime, sizeof(long long)); writeBuffer+=sizeof(long long);
+	std::memcpy(writeBuffer, &value, sizeof(long long)); writeBuffer+=sizeof(long long);
+}
+
+long long RTC::clockValue(long long currTime){
+	// The time source went backwards, ie the emulated clock was reset.
+	// Carry on from the saved value.
+	if(currTime < lastSaved) lastSaved = currTime;
+	long long value = valueSaved;
+	if(halt == 0) value += (currTime - lastSaved);
+	return value;
+}
+
+void RTC::latchClock(){
 	// Figure out what value to latch.
-	long long timeToLatch = valueSaved;
-	if(halt == 0) timeToLatch += (currTime - lastSaved);
+	long long timeToLatch = clockValue(currentTime());
 
 	sec = (timeToLatch % 60) & 0XFF;
 	timeToLatch /= 60; 
@@ -92,13 +118,9 @@ byte RTC::readLatchedData(int targetReg){
 }
 
 void RTC::writeToClock(int targetReg, byte data){
-	// Get current number of seconds. 
-	long long currTime = std::chrono::duration_cast<std::chrono::seconds>(
-		std::chrono::steady_clock::now().time_since_epoch()
-	).count();
+	long long currTime = currentTime();
 	// Figure out what value to latch.
-	long long timeToLatch = valueSaved;
-	if(halt == 0) timeToLatch += (currTime - lastSaved);
+	long long timeToLatch = clockValue(currTime);
 	
 	switch(targetReg){
 		// RTC S - Seconds.
@@ -144,10 +166,14 @@ void RTC::writeToClock(int targetReg, byte data){
 
 	valueSaved = timeToLatch;
 	lastSaved = currTime;
-	saveClockToFile(true);
+	// Only the buffer is updated here, `clockSave` writes it out in the background.
+	saveTimestamps(currTime);
 }
 
 void RTC::reset(){
+	// Write out the clock before it is cleared.
+	saveClock();
+	clockSave.stop();
 	sec = 0;
 	min = 0;
 	hour = 0;
@@ -157,52 +183,40 @@ void RTC::reset(){
 	carry = 0;
 	lastSaved = 0;
 	valueSaved = 0;
-	clockFile.close();
 }
 
-void RTC::saveClockToFile(bool partial){
-	int bytesToWrite = sizeof(long long)*2;
-	int offset = sizeof(byte)*4 + sizeof(bool)*3;
-	if (!partial){
-		bytesToWrite += offset;
-		offset = 0;
-	}
-    
-    byte* writeBuffer = new byte[
-        bytesToWrite
-    ];
-    byte* writeBufferStart = writeBuffer;
-
-	// Only write out the entire state if partial is turned off.
-	if(!partial){
-		std::memcpy(writeBuffer, &sec, sizeof(byte)); writeBuffer+=sizeof(byte);
-		std::memcpy(writeBuffer, &min, sizeof(byte)); writeBuffer+=sizeof(byte);
-		std::memcpy(writeBuffer, &hour, sizeof(byte)); writeBuffer+=sizeof(byte);
-		std::memcpy(writeBuffer, &dayL, sizeof(byte)); writeBuffer+=sizeof(byte);
-		
-		std::memcpy(writeBuffer, &dayH, sizeof(bool)); writeBuffer+=sizeof(bool);
-		std::memcpy(writeBuffer, &halt, sizeof(bool)); writeBuffer+=sizeof(bool);
-		std::memcpy(writeBuffer, &carry, sizeof(bool)); writeBuffer+=sizeof(bool);
-	}
-
-	std::memcpy(writeBuffer, &lastSaved, sizeof(long long)); writeBuffer+=sizeof(long long);
-	std::memcpy(writeBuffer, &valueSaved, sizeof(long long)); writeBuffer+=sizeof(long long);
+void RTC::saveClock(){
+	byte clock[RTC_SAVE_SIZE];
+	packClock(clock);
+	clockSave.update(0, clock, RTC_SAVE_SIZE);
 
 	// Write out the data.
-	clockFile.seekp(offset);
-    clockFile.write((char*)writeBufferStart, bytesToWrite);
-    delete[] writeBufferStart;
+	clockSave.flush();
 }
 
-void RTC::loadClockFromFile(){
-	int bytesToRead = sizeof(byte)*4 + sizeof(bool)*3 + sizeof(long long)*2;
-    byte* readBuffer = new byte[
-        bytesToRead
-    ];
-    byte* readBufferStart = readBuffer;
-	clockFile.seekg(0);
-    clockFile.read((char*)readBufferStart, bytesToRead);
+void RTC::packClock(byte* buffer){
+	byte* writeBuffer = buffer;
+	uint32_t magic = RTC_SAVE_MAGIC;
+	std::memcpy(writeBuffer, &magic, sizeof(uint32_t)); writeBuffer+=sizeof(uint32_t);
+	std::memcpy(writeBuffer, &sec, sizeof(byte)); writeBuffer+=sizeof(byte);
+	std::memcpy(writeBuffer, &min, sizeof(byte)); writeBuffer+=sizeof(byte);
+	std::memcpy(writeBuffer, &hour, sizeof(byte)); writeBuffer+=sizeof(byte);
+	std::memcpy(writeBuffer, &dayL, sizeof(byte)); writeBuffer+=sizeof(byte);
 	
+	std::memcpy(writeBuffer, &dayH, sizeof(bool)); writeBuffer+=sizeof(bool);
+	std::memcpy(writeBuffer, &halt, sizeof(bool)); writeBuffer+=sizeof(bool);
+	std::memcpy(writeBuffer, &carry, sizeof(bool)); writeBuffer+=sizeof(bool);
+	packTimestamps(writeBuffer, currentTime());
+}
+
+void RTC::loadClock(){
+	// Saves without the magic number predate it. They hold the same fields
+	// without it, but timestamped against a steady clock counting from boot.
+	uint32_t magic;
+	std::memcpy(&magic, clockData, sizeof(uint32_t));
+	bool legacySave = magic != RTC_SAVE_MAGIC;
+
+	byte* readBuffer = legacySave ? clockData : clockData + RTC_REGISTERS_OFFSET;
 	std::memcpy(&sec, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
 	std::memcpy(&min, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
 	std::memcpy(&hour, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
@@ -215,13 +229,23 @@ void RTC::loadClockFromFile(){
 	std::memcpy(&lastSaved, readBuffer, sizeof(long long)); readBuffer+=sizeof(long long);
 	std::memcpy(&valueSaved, readBuffer, sizeof(long long)); readBuffer+=sizeof(long long);
 
-	delete[] readBufferStart;
+	// Only the wall clock keeps running while the emulator is closed. A
+	// steady clock timestamp means nothing to it, so legacy clocks carry on
+	// from now and are written back in the current layout.
+	if(timeSource || legacySave) lastSaved = currentTime();
+	if(legacySave) saveClock();
+}
+
+void RTC::setTimeSource(rtcTimeSourceFunctionTemplate source){
+	valueSaved = clockValue(currentTime());
+	timeSource = source;
+	lastSaved = currentTime();
 }
 
 LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 	// Clear previous load attempts.
 	close();
-	Memory* memory = core->getMemory();
+	memory = core->getMemory();
 
 	// Read the ROM file.
 	romFile.open(filepath, std::ios::in | std::ios::binary);
@@ -290,7 +314,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::noMemoryControllerWrite, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::noMemoryControllerRead, this, std::placeholders::_1),
 			std::bind(&Cartridge::noMemoryControllerSaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::noMemoryControllerLoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::noMemoryControllerLoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::noMemoryControllerROMBank, this, std::placeholders::_1)
 		);
 		break;
 	case(MBC1):
@@ -299,7 +324,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB1Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB1Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB1SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB1LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB1LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB1ROMBank, this, std::placeholders::_1)
 		);
 		break;
 	case(MBC1_RAM):
@@ -308,7 +334,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB1Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB1Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB1SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB1LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB1LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB1ROMBank, this, std::placeholders::_1)
 		);
 		break;
 	case(MBC1_RAM_BATTERY):
@@ -317,7 +344,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB1Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB1Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB1SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB1LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB1LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB1ROMBank, this, std::placeholders::_1)
 		);
 		usingBattery = true;
 		break;
@@ -355,7 +383,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB3Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB3Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB3SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB3ROMBank, this, std::placeholders::_1)
 		);
 		usingBattery = true;
 		usingRTC = true;
@@ -366,7 +395,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB3Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB3Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB3SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB3ROMBank, this, std::placeholders::_1)
 		);
 		usingBattery = true;
 		usingRTC = true;
@@ -377,7 +407,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB3Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB3Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB3SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB3ROMBank, this, std::placeholders::_1)
 		);
 		break;
 	case(MBC3_RAM):
@@ -386,7 +417,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB3Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB3Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB3SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB3ROMBank, this, std::placeholders::_1)
 		);
 		break;
 	case(MBC3_RAM_BATTERY):
@@ -395,7 +427,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB3Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB3Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB3SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB3LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB3ROMBank, this, std::placeholders::_1)
 		);
 		usingBattery = true;
 		break;
@@ -417,7 +450,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB5Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB5Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB5SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB5LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB5LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB5ROMBank, this, std::placeholders::_1)
 		);
 		break;
 	case(MBC5_RAM):
@@ -426,7 +460,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB5Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB5Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB5SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB5LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB5LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB5ROMBank, this, std::placeholders::_1)
 		);
 		break;
 	case(MBC5_RAM_BATTERY):
@@ -435,7 +470,8 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 			std::bind(&Cartridge::controllerMCB5Write, this, std::placeholders::_1, std::placeholders::_2),
 			std::bind(&Cartridge::controllerMCB5Read, this, std::placeholders::_1),
 			std::bind(&Cartridge::controllerMCB5SaveToState, this, std::placeholders::_1),
-			std::bind(&Cartridge::controllerMCB5LoadFromState, this, std::placeholders::_1)
+			std::bind(&Cartridge::controllerMCB5LoadFromState, this, std::placeholders::_1),
+			std::bind(&Cartridge::controllerMCB5ROMBank, this, std::placeholders::_1)
 		);
 		usingBattery = true;
 		break;
@@ -554,13 +590,22 @@ LoadCartridgeReturnCodes Cartridge::open(const char* filepath, Core* core) {
 	// Set up timer.
 	if(usingRTC) realTimeClock.syncToCartridge(cartridgeName);
 
-	// Allocate the ROM.
-	romData = new byte[romSize];
-	// Read the ROM file into memory. For speed, load the entire ROM into memory -> Worst case 8Mb.
-	romFile.seekg(ROMBANK0_START);
-	romFile.read((char*) romData, romSize*sizeof(byte));
+	// Map the ROM file straight into memory, loading is then near instant and
+	// every emulator running the same ROM shares its pages. A file shorter than
+	// its header claims cannot be mapped, reads past its end would fault.
+	if(romMapping.open(filepath) && romMapping.getSize() >= romSize){
+		romData = romMapping.getData();
+	} else {
+		romMapping.close();
+		// Else read the entire ROM into memory -> Worst case 8Mb.
+		romBuffer = new byte[romSize];
+		romFile.seekg(ROMBANK0_START);
+		romFile.read((char*) romBuffer, romSize*sizeof(byte));
+		romData = romBuffer;
+	}
 	// ROMFile is no longer needed -> can close.
 	romFile.close();
+	updateBanks();
 
 	// Raise the ROM loaded flag and print debug info.
 	romLoaded = true;
@@ -574,20 +619,21 @@ void Cartridge::close() {
 		delete[] headerDataBuffer;
 		headerDataBuffer = nullptr;
 	}
+	// Write out the RAM before it is freed.
+	batterySave.stop();
 	if(externalRAM){
 		delete[] externalRAM;
 		externalRAM = nullptr;
 	}
-	if(romData){
-		delete[] romData;
-		romData = nullptr;
+	if(romBuffer){
+		delete[] romBuffer;
+		romBuffer = nullptr;
 	}
+	romMapping.close();
+	romData = nullptr;
 	// Close the ROM file.
 	if (romLoaded) romFile.close();
 
-	// Close the RAM file.
-	if(usingBattery) ramFile.close();
-
 	if(usingRTC) realTimeClock.reset();
 		
 	// Clear control flags.
@@ -613,6 +659,7 @@ void Cartridge::close() {
 	mbc5RAMEnable = false;
 	mbc5ROMBank = 0;
 	mbc5RAMBank = 0;
+	updateBanks();
 }
 
 std::string Cartridge::convertBytesToHumanReadable(uint32_t size){
@@ -649,24 +696,72 @@ void Cartridge::setUpRAMBatteryFile(){
 		.append(cartridgeName)
 		.append(".sav");
 
-	// Try an open the battery save.
-	ramFile.open(batSaveFilePath, std::ios::in | std::ios::out | std::ios::binary);
+	// Create a battery save directory if one does not exist.
+	if (!std::filesystem::is_directory(BAT_SAVE_SUB_DIR) || !std::filesystem::exists(BAT_SAVE_SUB_DIR)) {
+		std::filesystem::create_directory(BAT_SAVE_SUB_DIR);
+	}
+
+	// Loads the save, or creates one, and writes RAM back in the background from now on.
+	batterySave.start(batSaveFilePath, externalRAM, ramSize);
+}
 
-	// Save file does not exist. Make a new one.
-	if (!ramFile.is_open()){
-		ramFile.close();
-		// Create a battery save directory if one does not exist.
-		if (!std::filesystem::is_directory(BAT_SAVE_SUB_DIR) || !std::filesystem::exists(BAT_SAVE_SUB_DIR)) {
-			std::filesystem::create_directory(BAT_SAVE_SUB_DIR);
+void Cartridge::updateBanks(){
+	int ramBankNumber = 0;
+	bool ramEnabled = false;
+	romBank0Number = 0;
+	switch (cartridgeType) {
+	case(MBC1):
+	case(MBC1_RAM):
+	case(MBC1_RAM_BATTERY):
+		// Mode 1 switches the upper bits into bank X0 and the RAM bank.
+		if(mbc1Mode == 0x1){
+			romBank0Number = mbc1ROMSecondaryBank << 5;
+			if((uint32_t)(romBank0Number*ROM_BANK_SIZE) > romSize) romBank0Number = 0;
+			ramBankNumber = mbc1ROMSecondaryBank;
 		}
+		// If the bank is too large, just use the bottom bits.
+		romBankNNumber = (mbc1ROMSecondaryBank << 5) + mbc1ROMBank;
+		if((uint32_t)(romBankNNumber*ROM_BANK_SIZE) > romSize) romBankNNumber = mbc1ROMBank;
+		ramEnabled = mbc1RAMEnable;
+		break;
+	case(MBC3_TIMER_BATTERY):
+	case(MBC3_TIMER_RAM_BATTERY):
+	case(MBC3):
+	case(MBC3_RAM):
+	case(MBC3_RAM_BATTERY):
+		romBankNNumber = mbc3ROMBank;
+		// The RTC registers are not plain memory.
+		ramEnabled = mbc3RAMEnable && mbc3RAMBank <= 0x3;
+		ramBankNumber = mbc3RAMBank;
+		break;
+	case(MBC5):
+	case(MBC5_RAM):
+	case(MBC5_RAM_BATTERY):
+		romBankNNumber = mbc5ROMBank;
+		ramEnabled = mbc5RAMEnable;
+		ramBankNumber = mbc5RAMBank;
+		break;
+	default:
+		romBankNNumber = 1;
+		break;
+	}
 
-		// Create a new file. 
-		ramFile.open(batSaveFilePath, std::ios::out | std::ios::binary);
-		ramFile.write((char*)externalRAM, ramSize);
-	} else {
-		// Load the buffer with the save files contents.
-		ramFile.read((char*)externalRAM, ramSize);
+	// Wrap bank numbers past the end of the ROM, as the unused upper bank bits would.
+	uint32_t romBankCount = romSize / ROM_BANK_SIZE;
+	if(romBankCount){
+		romBank0Number %= romBankCount;
+		romBankNNumber %= romBankCount;
 	}
+	romBank0 = romData ? romData + romBank0Number*ROM_BANK_SIZE : nullptr;
+	romBankN = romData ? romData + romBankNNumber*ROM_BANK_SIZE : nullptr;
+
+	byte* ramBank = nullptr;
+	uint32_t ramLength = ramSize < RAM_BANK_SIZE ? ramSize : RAM_BANK_SIZE;
+	if(ramEnabled && externalRAM && ramBankNumber*RAM_BANK_SIZE + ramLength <= ramSize){
+		ramBank = externalRAM + ramBankNumber*RAM_BANK_SIZE;
+	}
+
+	if(memory) memory->setCartridgeBanks(romBank0, romBankN, ramBank, ramLength);
 }
 
 /*======================================================================*
@@ -677,6 +772,10 @@ byte Cartridge::noMemoryControllerRead(word address){
 	if(address >= romSize) return HIGH_IMPEDANCE;
 	return romData[address-ROMBANK0_START];
 }
+word Cartridge::noMemoryControllerROMBank(word address){
+	// Both regions are fixed.
+	return address >> 14;
+}
 void Cartridge::noMemoryControllerWrite(word address, byte data){
 	// No Op!
 }
@@ -692,25 +791,12 @@ void Cartridge::noMemoryControllerLoadFromState(std::ifstream & stateFile){
  *======================================================================*/
 
 byte Cartridge::controllerMCB1Read(word address){
-	// ROM Bank X0.
+	// ROM Bank X0, selected by `updateBanks`.
 	if(address >= ROMBANK0_START && address <= ROMBANK0_END){
-		// Return the first bank always in mode 0.
-		if(mbc1Mode == 0x0) return romData[address - ROMBANK0_START];
-		// Else use the secondary bank reg.
-		int bankToRead = ((mbc1ROMSecondaryBank << 5));
-		if((uint32_t)(bankToRead*ROM_BANK_SIZE) > romSize) bankToRead = 0;
-		uint32_t addressToRead =  bankToRead*ROM_BANK_SIZE + (address - ROMBANK0_START);
-		return romData[addressToRead];
+		return romBank0[address - ROMBANK0_START];
 	// ROM Bank 01-7F.
 	} else if(address >= ROMBANKN_START && address <= ROMBANKN_END){
-		// Try reading using the secondary bank.
-		int bankToRead = ((mbc1ROMSecondaryBank << 5) + mbc1ROMBank);
-		// If its too large, just use the bottom bits.
-		if((uint32_t)(bankToRead*ROM_BANK_SIZE) > romSize) bankToRead = mbc1ROMBank;
-		//std::cout << "Read ROM Bank " << bankToRead << std::endl;
-		// if(mbc1Mode == 0x1) std::cout << (int) mbc1ROMSecondaryBank << " " << (int) bankToRead << std::endl;
-		uint32_t addressToRead = bankToRead*ROM_BANK_SIZE + (address - ROMBANKN_START);
-		return romData[addressToRead];
+		return romBankN[address - ROMBANKN_START];
 	// RAM Bank 00–03, if any.
 	} else if(address >= EXTERNALRAM_START && address <= EXTERNALRAM_END){
 		// If RAM is disabled or the read is too large return high impedance.
@@ -727,6 +813,10 @@ byte Cartridge::controllerMCB1Read(word address){
 	return HIGH_IMPEDANCE;
 }
 
+word Cartridge::controllerMCB1ROMBank(word address){
+	if(address >= ROMBANK0_START && address <= ROMBANK0_END) return romBank0Number;
+	return romBankNNumber;
+}
 void Cartridge::controllerMCB1Write(word address, byte data){
 	// std::cout << std::hex << (int) address << " " << (int) data << std::endl;
 	// RAM Enable.
@@ -761,13 +851,11 @@ void Cartridge::controllerMCB1Write(word address, byte data){
 		// Write the value of RAM.
 		externalRAM[addressToWrite] = data;
 
-		// Write to the "battery backed" file. !!!TODO do this on another thread and maybe group writes for efficiency.
-		if(usingBattery){
-			ramFile.seekp(addressToWrite);
-			ramFile.write((char*) &data, 1);
-		}
 	}
 	// If we write outside this address space -> simply ignore.
+
+	// A register changed, reselect the banks.
+	if(address <= ROMBANKN_END) updateBanks();
 }
 void Cartridge::controllerMCB1SaveToState(std::ofstream & stateFile){
 	int ramCopySize = sizeof(byte)*ramSize;
@@ -807,6 +895,7 @@ void Cartridge::controllerMCB1LoadFromState(std::ifstream & stateFile){
 	std::memcpy(externalRAM, readBuffer, ramCopySize); readBuffer+=ramCopySize;
 
 	delete[] readBufferStart;
+	updateBanks();
 }
 
 /*======================================================================*
@@ -815,11 +904,10 @@ void Cartridge::controllerMCB1LoadFromState(std::ifstream & stateFile){
 byte Cartridge::controllerMCB3Read(word address){
 	// ROM Bank 0.
 	if(address >= ROMBANK0_START && address <= ROMBANK0_END){
-		return romData[address - ROMBANK0_START];
+		return romBank0[address - ROMBANK0_START];
 	// ROM Bank 01-7F.
 	} else if(address >= ROMBANKN_START && address <= ROMBANKN_END){
-		uint32_t addressToRead = mbc3ROMBank*ROM_BANK_SIZE + (address - ROMBANKN_START);
-		return romData[addressToRead];
+		return romBankN[address - ROMBANKN_START];
 	// RAM Bank 00–03 or RTC Register 08-0C.
 	} else if(address >= EXTERNALRAM_START && address <= EXTERNALRAM_END){
 		// If RAM is disabled or the read is too large return high impedance.
@@ -849,6 +937,10 @@ byte Cartridge::controllerMCB3Read(word address){
 	}
 	return HIGH_IMPEDANCE;
 }
+word Cartridge::controllerMCB3ROMBank(word address){
+	if(address >= ROMBANK0_START && address <= ROMBANK0_END) return romBank0Number;
+	return romBankNNumber;
+}
 void Cartridge::controllerMCB3Write(word address, byte data){
 	// RAM and Timer Enable.
 	if(address >= 0x0000 && address <= 0x1FFF){
@@ -890,12 +982,6 @@ void Cartridge::controllerMCB3Write(word address, byte data){
 				uint32_t addressToWrite = mbc3RAMBank*RAM_BANK_SIZE + (address - EXTERNALRAM_START);
 				// Write the value of RAM.
 				externalRAM[addressToWrite] = data;
-
-				// Write to the "battery backed" file. !!!TODO do this on another thread and maybe group writes for efficiency.
-				if(usingBattery){
-					ramFile.seekp(addressToWrite);
-					ramFile.write((char*) &data, 1);
-				}
 				break;
 			}
 			// RTC.
@@ -910,6 +996,9 @@ void Cartridge::controllerMCB3Write(word address, byte data){
 		}
 
 	}
+
+	// A register changed, reselect the banks.
+	if(address <= ROMBANKN_END) updateBanks();
 }
 void Cartridge::controllerMCB3SaveToState(std::ofstream & stateFile){
 	int ramCopySize = sizeof(byte)*ramSize;
@@ -931,7 +1020,7 @@ void Cartridge::controllerMCB3SaveToState(std::ofstream & stateFile){
     delete[] writeBufferStart;
 
 	// Save the clock.
-	if(usingRTC) realTimeClock.saveClockToFile();
+	if(usingRTC) realTimeClock.saveClock();
 }
 void Cartridge::controllerMCB3LoadFromState(std::ifstream & stateFile){
 	int ramCopySize = sizeof(byte)*ramSize;
@@ -951,25 +1040,19 @@ void Cartridge::controllerMCB3LoadFromState(std::ifstream & stateFile){
 
 	delete[] readBufferStart;
 
-	// Sync the bat file.
-	if(usingBattery){
-		ramFile.seekp(0);
-		ramFile.write((char*) externalRAM, ramCopySize);
-	}
-
 	// Load the clock.
-	if(usingRTC) realTimeClock.loadClockFromFile();
+	if(usingRTC) realTimeClock.loadClock();
+	updateBanks();
 }
 
 
 byte Cartridge::controllerMCB5Read(word address){
 	// ROM Bank 0.
 	if(address >= ROMBANK0_START && address <= ROMBANK0_END){
-		return romData[address - ROMBANK0_START];
+		return romBank0[address - ROMBANK0_START];
 	// ROM Bank 01-7F.
 	} else if(address >= ROMBANKN_START && address <= ROMBANKN_END){
-		uint32_t addressToRead = mbc5ROMBank*ROM_BANK_SIZE + (address - ROMBANKN_START);
-		return romData[addressToRead];
+		return romBankN[address - ROMBANKN_START];
 	// RAM Bank 00–03.
 	} else if(address >= EXTERNALRAM_START && address <= EXTERNALRAM_END){
 		// If RAM is disabled or the read is too large return high impedance.
@@ -981,6 +1064,10 @@ byte Cartridge::controllerMCB5Read(word address){
 	} return HIGH_IMPEDANCE;
 }
 
+word Cartridge::controllerMCB5ROMBank(word address){
+	if(address >= ROMBANK0_START && address <= ROMBANK0_END) return romBank0Number;
+	return romBankNNumber;
+}
 void Cartridge::controllerMCB5Write(word address, byte data){
 	// RAM Enable.
 	if(address >= 0x0000 && address <= 0x1FFF){
@@ -1005,12 +1092,10 @@ void Cartridge::controllerMCB5Write(word address, byte data){
 		uint32_t addressToWrite = mbc5RAMBank*RAM_BANK_SIZE + (address - EXTERNALRAM_START);
 		// Write the value of RAM.
 		externalRAM[addressToWrite] = data;
-		// Write to the "battery backed" file. !!!TODO do this on another thread and maybe group writes for efficiency.
-		if(usingBattery){
-			ramFile.seekp(addressToWrite);
-			ramFile.write((char*) &data, 1);
-		}
 	}
+
+	// A register changed, reselect the banks.
+	if(address <= ROMBANKN_END) updateBanks();
 }
 
 void Cartridge::controllerMCB5SaveToState(std::ofstream & stateFile){
@@ -1047,10 +1132,5 @@ void Cartridge::controllerMCB5LoadFromState(std::ifstream & stateFile){
 	std::memcpy(externalRAM, readBuffer, ramCopySize); readBuffer+=ramCopySize;
 
 	delete[] readBufferStart;
-
-	// Sync the bat file.
-	if(usingBattery){
-		ramFile.seekp(0);
-		ramFile.write((char*) externalRAM, ramCopySize);
-	}
-}
\ No newline at end of file
+	updateBanks();
+}
@@ -15,21 +15,38 @@ The header implementation for the main emulator core.
 
 Core::Core(ExecutionModes mode) {
     executionMode = mode;
-    ppu.init();
-    apu.init();
-    ioController.init(&cpu, &ppu, &apu);
-    memory.init(&cpu, &ioController, &ppu, &cartridge);
-
+    // One allocation, laid out in the order the components take from it.
+    // The arena reports its own failure.
+    if(!arena.init(PPU::arenaSize() + APU::arenaSize() + Memory::arenaSize())) return;
+    if(!ppu.init(arena) || !apu.init(arena)){
+        std::cout << "ERROR: Could not set up the PPU and APU's memory!" << std::endl;
+        return;
+    }
+    ioController.init(&cpu, &ppu, &apu, &scheduler);
+    if(!memory.init(&cpu, &ioController, &ppu, &cartridge, arena)){
+        std::cout << "ERROR: Could not set up the emulator's memory!" << std::endl;
+        return;
+    }
 
     cpu.bindMemory(&memory);
+    cpu.bindHardware(&scheduler, &apu);
     ppu.bindMemory(&memory);
+    ppu.bindScheduler(&scheduler);
     ioController.bindMemory(&memory);
 
     // Set Core to default state.
     resetCore();
+    initialized = true;
 }
 
 void Core::resetCore(){
+    stopTrace();
+    // Keep the profile of the game being closed.
+    if(profilingEnabled && cartridge.isROMLoaded()){
+        writeProfileReports();
+        profiler.reset();
+    }
+
     // Clear Cartridge.
     cartridge.close();
 
@@ -41,6 +58,8 @@ void Core::resetCore(){
 }
 
 Core::~Core() {
+    stopTrace();
+    if(profilingEnabled && cartridge.isROMLoaded()) writeProfileReports();
     cartridge.close();
     memory.destroy();
     apu.destroy();
@@ -63,6 +82,12 @@ LoadCartridgeReturnCodes Core::loadROM(std::string filePath){
                 cpu.setInitalValuesColour();
             }
             ppu.setGBCMode(cartridge.isGBCROM());
+            // Use the game's ahead-of-time compiled module if one was built.
+            aot.load(
+                (std::filesystem::path(AOT_SUB_DIR) / (cartridge.getCartridgeName() + AOT_LIBRARY_EXTENSION)).string(),
+                &cpu,
+                &cartridge
+            );
             break;
         case CANNOT_READ_FILE:
             message = "ERROR: Could not open the the ROM file. Check permissions!";
@@ -119,9 +144,42 @@ void Core::populateCpuStateBuffer(CPU_State* CPU_StateBuffer){
 
 
 void Core::runForFrame(bool breakOnCPU) {
-    cycles cycleCounter = 0;
-    while (cycleCounter < CYCLES_PER_FRAME) {
-        // Run hardware.
+    scheduler.schedule(EVENT_FRAME_END, CYCLES_PER_FRAME);
+    while (!scheduler.isDue(EVENT_FRAME_END)) {
+        scheduleHardwareEvents();
+
+        cycles bulkCycles = 0;
+        bool fastPathsEnabled = !breakOnCPU && enabledCPUBreakpoints.empty();
+        // While the CPU waits for an interrupt nothing but counters change
+        // until the next hardware event, jump straight to it.
+        if(fastPathsEnabled && waitSkipEnabled && cpu.isWaiting()){
+            scheduler.cancel(EVENT_CPU);
+            bulkCycles = scheduler.cyclesUntilNextEvent();
+            cpu.advance(bulkCycles);
+        // Likewise nothing else can see a copy or fill loop's writes until then.
+        } else if(fastPathsEnabled && cpu.atFusibleLoop()){
+            scheduler.cancel(EVENT_CPU);
+            bulkCycles = cpu.runFusedLoop(scheduler.cyclesUntilNextEvent());
+        } else {
+            // Threaded dispatch runs every instruction due before the next
+            // hardware event itself, keeping the scheduler and APU in step.
+            if(fastPathsEnabled && cpu.getDispatchMode() == DISPATCH_THREADED){
+                scheduler.cancel(EVENT_CPU);
+                if(cpu.runThreaded(scheduler.cyclesUntilNextEvent())) continue;
+            }
+            // Otherwise the CPU only banks cycles until its next instruction is due.
+            scheduler.schedule(EVENT_CPU, cpu.cyclesUntilWork());
+            bulkCycles = scheduler.cyclesUntilNextEvent();
+            cpu.advance(bulkCycles);
+        }
+        if(bulkCycles){
+            // The timers and the PPU catch up to the master cycle count by themselves.
+            apu.advance(bulkCycles);
+            scheduler.advance(bulkCycles);
+            continue;
+        }
+
+        // An event is due, run the hardware for a single cycle.
         handleInterrupts();
 
         cycles cpuWork = cpu.cycle();
@@ -137,17 +195,32 @@ void Core::runForFrame(bool breakOnCPU) {
             writeBit(apuDivCounterEvents, 0, apuDivCounterAfter % 2 == 0);
         }
         apu.cycle(apuDivCounterEvents);
-        ppu.cycle();
-      
-        if(std::find(enabledCPUBreakpoints.begin(),enabledCPUBreakpoints.end(), cpu.getPC()) != enabledCPUBreakpoints.end()){
+        // The PPU only runs on its own events, or after one of its registers was written.
+        if(scheduler.isDue(EVENT_PPU)) ppu.cycle();
+        scheduler.advance(1);
+
+        // PC only moves when the CPU does some work.
+        if(cpuWork && !enabledCPUBreakpoints.empty() &&
+           std::find(enabledCPUBreakpoints.begin(),enabledCPUBreakpoints.end(), cpu.getPC()) != enabledCPUBreakpoints.end()){
             breakOnCPU = true;
             pauseEmulatorExecution();
         }
   
         // Stop execution if the CPU finished an instuction. 
         if(breakOnCPU && cpuWork) break;
-        cycleCounter ++;
     }
+    if(scheduler.isDue(EVENT_FRAME_END)) framesEmulated++;
+}
+
+void Core::scheduleHardwareEvents(){
+    scheduler.schedule(EVENT_PPU, ppu.cyclesUntilEvent());
+    scheduler.schedule(EVENT_TIMERS, ioController.cyclesUntilEvent(cpu.getDoubleSpeedMode()));
+
+    // A pending interrupt wakes the CPU up straight away, and is dispatched
+    // if interrupts are enabled. Otherwise it changes nothing.
+    byte validInterrupts = memory.read(INTERRUPT_ENABLE_REGISTER_ADDR) & memory.read(INTERRUPT_FLAG_REGISTER_ADDR);
+    if(validInterrupts != 0 && (cpu.getMasterInterruptEnabledFlag() || cpu.getLowPowerMode())) scheduler.schedule(EVENT_INTERRUPT, 0);
+    else scheduler.cancel(EVENT_INTERRUPT);
 }
 
 /**
@@ -259,6 +332,152 @@ void Core::loadState(int stateNum){
     std::cout << "Successfully loaded state from \"" << fileName << "\"!" << std::endl;
 }
 
+void Core::setAOTRecording(bool state){
+    acquireMutexLock();
+    aotRecording = state;
+    cpu.setBlockStartLog(state ? aot.getBlockLog() : nullptr);
+    releaseMutexLock();
+}
+
+bool Core::exportAOTModule(){
+    if(!cartridge.isROMLoaded()){
+        std::cout << "No ROM is currently loaded. Nothing to export..." << std::endl;
+        return false;
+    }
+
+    // Create the AOT directory.
+    if (!std::filesystem::is_directory(AOT_SUB_DIR) || !std::filesystem::exists(AOT_SUB_DIR)) {
+        std::filesystem::create_directory(AOT_SUB_DIR);
+    }
+
+    std::filesystem::path basePath = std::filesystem::path(AOT_SUB_DIR) / cartridge.getCartridgeName();
+    std::string logPath = basePath.string() + ".log";
+
+    acquireMutexLock();
+    bool exported = aot.saveBlockLog(logPath) && aot.exportSource(&cartridge, logPath, basePath.string() + ".cpp");
+    releaseMutexLock();
+    return exported;
+}
+
+int Core::runAOTExport(const std::string& romPath, int frames){
+    Core* core = new Core(CONTINUE);
+    bool exported = false;
+    if(core->initialized && core->loadROM(romPath) == SUCCESS){
+        core->setAOTRecording(true);
+        for(int frame = 0; frame < frames; frame++) core->runForFrame(false);
+        exported = core->exportAOTModule();
+    }
+    delete core;
+    return exported ? 0 : 1;
+}
+
+void Core::setProfilingEnabled(bool state){
+#ifdef CPU_PROFILER
+    acquireMutexLock();
+    profilingEnabled = state;
+    cpu.setProfiler(state ? &profiler : nullptr);
+    releaseMutexLock();
+#else
+    std::cout << "The emulator was built without the profiler (CPU_NO_PROFILER)." << std::endl;
+#endif
+}
+
+void Core::writeProfileReports(){
+    // Create the profile directory.
+    if (!std::filesystem::is_directory(PROFILE_SUB_DIR) || !std::filesystem::exists(PROFILE_SUB_DIR)) {
+        std::filesystem::create_directory(PROFILE_SUB_DIR);
+    }
+
+    std::filesystem::path basePath = std::filesystem::path(PROFILE_SUB_DIR) / cartridge.getCartridgeName();
+    if(profiler.writeReport(basePath.string() + ".csv") && profiler.writeReport(basePath.string() + ".json")){
+        std::cout << "Saved the profile to \"" << basePath.string() << ".csv/.json\"!" << std::endl;
+    }
+}
+
+void Core::saveProfile(){
+    if(!cartridge.isROMLoaded()){
+        std::cout << "No ROM is currently loaded. Nothing to save..." << std::endl;
+        return;
+    }
+
+    acquireMutexLock();
+    writeProfileReports();
+    releaseMutexLock();
+}
+
+void Core::resetProfile(){
+    acquireMutexLock();
+    profiler.reset();
+    releaseMutexLock();
+}
+
+std::vector<ProfileHotSpot> Core::getProfileHotSpots(size_t count, uint64_t* totalCycles){
+    acquireMutexLock();
+    std::vector<ProfileHotSpot> hotSpots = profiler.getHotSpots(count);
+    *totalCycles = profiler.getTotalCycles();
+    releaseMutexLock();
+    return hotSpots;
+}
+
+void Core::setTracing(bool state){
+    acquireMutexLock();
+    stopTrace();
+    if(state){
+        if(!cartridge.isROMLoaded()){
+            std::cout << "No ROM is currently loaded. Nothing to trace..." << std::endl;
+            releaseMutexLock();
+            return;
+        }
+
+        // Create the trace directory.
+        if (!std::filesystem::is_directory(TRACE_SUB_DIR) || !std::filesystem::exists(TRACE_SUB_DIR)) {
+            std::filesystem::create_directory(TRACE_SUB_DIR);
+        }
+
+        std::string fileName = (std::filesystem::path(TRACE_SUB_DIR) / (cartridge.getCartridgeName() + ".trace")).string();
+        if(traceRecorder.start(fileName, compressTraces)){
+            cpu.setTraceRecorder(&traceRecorder);
+            std::cout << "Tracing to \"" << fileName << "\"..." << std::endl;
+        }
+    }
+    releaseMutexLock();
+}
+
+void Core::setDispatchMode(CPUDispatchModes mode){
+    acquireMutexLock();
+    cpu.setDispatchMode(mode);
+    releaseMutexLock();
+}
+
+void Core::setJITEnabled(bool state){
+    acquireMutexLock();
+    cpu.setJITEnabled(state);
+    releaseMutexLock();
+}
+
+void Core::setRTCTimeSource(RTCTimeSources source, long long fixedTime){
+    acquireMutexLock();
+    switch(source){
+        case RTC_EMULATED_CLOCK:
+            cartridge.setRTCTimeSource([this](){ return (long long)(cpu.getClock() / CLOCKSPEED); });
+            break;
+        case RTC_FIXED_TIME:
+            cartridge.setRTCTimeSource([fixedTime](){ return fixedTime; });
+            break;
+        default:
+            cartridge.setRTCTimeSource(nullptr);
+            break;
+    }
+    releaseMutexLock();
+}
+
+void Core::stopTrace(){
+    if(!traceRecorder.isRecording()) return;
+    cpu.setTraceRecorder(nullptr);
+    traceRecorder.stop();
+    std::cout << "Stopped tracing." << std::endl;
+}
+
 void Core::saveState(int stateNum){
     if(!cartridge.isROMLoaded()){
         std::cout << "No ROM is currently loaded. Nothing to save..." << std::endl;
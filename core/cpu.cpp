@@ -3,33 +3,27 @@
  */
 
 #include "include\cpu.h"
+#include "include\scheduler.h"
+#include "include\apu.h"
 #include <iostream>
+#include <algorithm>
 
-void popHelper(CPU *cpu, reg &dest)
+void popHelper(CPU *cpu, word &dest)
 {
     // Pop the data off the stack.
-    word data = cpu->memory->read(cpu->SP.read());
-    cpu->SP++;
-    data = data | (cpu->memory->read(cpu->SP.read())) << 8;
-    cpu->SP++;
-
-    // Load reg with the popped data.
-    dest = data;
+    dest = cpu->memory->read16(cpu->regs.SP);
+    cpu->regs.SP += 2;
 }
 
-void pushHelper(CPU *cpu, reg &source)
+void pushHelper(CPU *cpu, word source)
 {
-    word data = source.read();
-
     // Push the data onto the stack.
-    cpu->SP--;
-    cpu->memory->write(cpu->SP.read(), data >> 8);
-    cpu->SP--;
-    cpu->memory->write(cpu->SP.read(), data & 0xFF);
+    cpu->regs.SP -= 2;
+    cpu->memory->write16(cpu->regs.SP, source);
 }
 
 CPU::CPU(){
-    reg_AF.setAsFlagReg();
+    regs = {};
 }
 
 void CPU::toggleDoubleSpeedMode(){
@@ -44,27 +38,30 @@ void CPU::setInitalValues()
     doubleSpeedMode = false;
     lowPowerMode = false;
     // Init routine according to http://bgb.bircd.org/pandocs.htm#powerupsequence.
-    reg_AF = (word)0x01B0;
-    reg_BC = (word)0x0013;
-    reg_DE = (word)0x00D8;
-    reg_HL = (word)0x014D;
+    regs.reg_AF = 0x01B0;
+    lazyFlags.operation = LAZY_FLAGS_NONE;
+    regs.reg_BC = 0x0013;
+    regs.reg_DE = 0x00D8;
+    regs.reg_HL = 0x014D;
 
-    PC = (word)0x0100;
-    SP = (word)0xFFFE;
+    regs.PC = 0x0100;
+    regs.SP = 0xFFFE;
 
     masterInterruptEnableFlag = false;
     activeInterruptVector = 0x0000;
+    idleLoop.stop();
+    clock = 0;
 }
 
 void CPU::setInitalValuesColour(){
     // https://gbdev.io/pandocs/CGB_Registers.html#detecting-cgb-and-gba-functions
-    *A = 0x11;
+    regs.A = 0x11;
 }
 
 byte CPU::readNextInstructionByte()
 {
     // Fetch the next byte of the instruction.
-    byte nextOpcode = memory->read(PC.read());
+    byte nextOpcode = memory->read(regs.PC);
 
     // If the CPU is currently facing the double read bug, don't increase PC this time.
     if(doubleReadBug) doubleReadBug = false;
@@ -74,48 +71,195 @@ byte CPU::readNextInstructionByte()
     return nextOpcode;
 }
 
-cycles CPU::fetchAndExecute()
+byte CPU::peekNextOpcode()
 {
-    // Read the next instuction and increment PC.
-    byte nextOpcode = readNextInstructionByte();
-
-    // Translate the OP code into a instruction.
-    Instruction nextInstruction = instructionSet.set[nextOpcode];
-
-    // If the instuction has immediate data, additional memory needs are necessary to populate parsed data.
-    switch (nextInstruction.length)
-    {
-    case 2:
-        // Constructs a word from the two bytes of parsed data.
-        // PC+1 is placed in the lower 8 bits.
-        // Upper 8 bits are left unused.
-        parsedData = readNextInstructionByte();
-        break;
-    case 3:
-        // Constructs a word from the two bytes of parsed data.
-        // PC+1 is placed in the lower 8 bits.
-        // PC+2 is placed in the upper 8 bits.
-        parsedData = readNextInstructionByte() | (readNextInstructionByte() << 8);
-        break;
+    if(decodeCacheEnabled){
+        const DecodedInstruction* decoded = decodeCache.lookup(memory, regs.PC);
+        if(decoded) return decoded->opcode;
+    }
+    return memory->read(regs.PC);
+}
 
-    default:
-        break;
+byte CPU::fetchInstruction(const DecodedInstruction* decoded)
+{
+    byte nextOpcode;
+    word instructionPC = regs.PC;
+
+    if(decoded){
+        // Let the recompiler know a basic block was entered.
+        if(atBlockStart){
+            if(jitEnabled) jit.recordBlockStart(this, regs.PC);
+            if(blockStartLog) blockStartLog->insert((memory->getMappedROMBank(regs.PC) << 16) | regs.PC);
+        }
+        nextOpcode = decoded->opcode;
+        parsedData = decoded->parsedData;
+        regs.PC += decoded->length;
+    } else {
+        // Read the next instuction and increment PC.
+        nextOpcode = readNextInstructionByte();
+
+        // If the instuction has immediate data, additional memory needs are necessary to populate parsed data.
+        switch (INSTRUCTION_SET[nextOpcode].length)
+        {
+        case 2:
+            // Constructs a word from the two bytes of parsed data.
+            // PC+1 is placed in the lower 8 bits.
+            // Upper 8 bits are left unused.
+            parsedData = readNextInstructionByte();
+            break;
+        case 3:
+            // Constructs a word from the two bytes of parsed data.
+            // PC+1 is placed in the lower 8 bits.
+            // PC+2 is placed in the upper 8 bits.
+            parsedData = memory->read16(regs.PC);
+            regs.PC += 2;
+            break;
+
+        default:
+            break;
+        }
     }
 
+    // Translate the OP code into a instruction.
+    const Instruction& nextInstruction = INSTRUCTION_SET[nextOpcode];
+    atBlockStart = JIT::endsBlock({nextOpcode, nextInstruction.length, parsedData});
+
     // Print OP code data.
     if (verbose)
     {
         std::cout << nextInstruction.opcode << std::endl;
     }
 
+    if(traceRecorder){
+        materializeFlags();
+        traceRecorder->push({
+            clock, instructionPC, regs.reg_AF, regs.reg_BC, regs.reg_DE, regs.reg_HL, regs.SP,
+            instructionPC <= ROMBANKN_END ? memory->getMappedROMBank(instructionPC) : (word)TRACE_NO_BANK,
+            nextOpcode, nextOpcode == PREFIX_CB ? (byte)parsedData : (byte)0
+        });
+    }
+    return nextOpcode;
+}
+
+cycles CPU::fetchAndExecute()
+{
+    // Use the pre-decoded instruction if there is one. The double read bug 
+    // changes how the instruction bytes are read so it always bypasses the cache.
+    const DecodedInstruction* decoded = nullptr;
+    word instructionPC = regs.PC;
+    if(decodeCacheEnabled && !doubleReadBug) decoded = decodeCache.lookup(memory, regs.PC);
+    byte nextOpcode = fetchInstruction(decoded);
+
     // Clear the cashed cycles.
     cyclesSinceLastInstuction = 0;
     // Execute the instuction and return number of cycles.
-    cycles executedCycles =  nextInstruction.execute(this);
+    cycles executedCycles = INSTRUCTION_HANDLERS[nextOpcode](this);
+
+#ifdef CPU_PROFILER
+    if(profiler){
+        uint32_t bank = instructionPC <= ROMBANKN_END ? memory->getMappedROMBank(instructionPC) : PROFILER_NO_BANK;
+        profiler->record(bank, instructionPC, nextOpcode, nextOpcode == PREFIX_CB ? (byte)parsedData : 0, executedCycles);
+    }
+#endif
+    if(isInstrumented()) return executedCycles;
+    afterInstruction(instructionPC, nextOpcode);
     return executedCycles;
 }
 
+void CPU::advanceHardware(cycles numCycles){
+    if(scheduler) scheduler->advance(numCycles);
+    if(apu) apu->advance(numCycles);
+}
+
+bool CPU::startThreadedInstruction(ThreadedRun& run, word& instructionPC, byte& opcode){
+    const DecodedInstruction* decoded = decodeCacheEnabled ? decodeCache.lookup(memory, regs.PC) : nullptr;
+
+    // The instruction runs on the call to `cycle` which banks all of its 
+    // cycles, the same wait `cyclesUntilWork` works out.
+    cycles required = INSTRUCTION_SET[decoded ? decoded->opcode : memory->read(regs.PC)].cycleCount;
+    cycles wait = 0;
+    if(required > cyclesSinceLastInstuction) wait = (required - cyclesSinceLastInstuction - 1) / (doubleSpeedMode ? 2 : 1);
+    if(run.elapsed + wait >= run.maxCycles) return false;
+
+    run.elapsed += wait + 1;
+    clock += wait + 1;
+    advanceHardware(wait);
+
+    instructionPC = regs.PC;
+    opcode = fetchInstruction(decoded);
+    cyclesSinceLastInstuction = 0;
+    return true;
+}
+
+bool CPU::finishThreadedInstruction(ThreadedRun& run, word instructionPC, byte opcode){
+    // The rest of the cycle the instruction ran on.
+    advanceHardware(1);
+    afterInstruction(instructionPC, opcode);
+
+    return !lowPowerMode && !doubleReadBug &&
+        masterInterruptEnableFlag == run.interruptsEnabled && doubleSpeedMode == run.doubleSpeed &&
+        memory->getIOAccessCount() == run.ioAccesses &&
+        !idleLoop.isSkipping() && !loopFusion.isPending();
+}
+
+// Expands `X` once per opcode with the opcode as two hex digits.
+#define OPCODE_ROW(X, h) \
+    X(h##0) X(h##1) X(h##2) X(h##3) X(h##4) X(h##5) X(h##6) X(h##7) \
+    X(h##8) X(h##9) X(h##A) X(h##B) X(h##C) X(h##D) X(h##E) X(h##F)
+#define FOR_EACH_OPCODE(X) \
+    OPCODE_ROW(X, 0) OPCODE_ROW(X, 1) OPCODE_ROW(X, 2) OPCODE_ROW(X, 3) \
+    OPCODE_ROW(X, 4) OPCODE_ROW(X, 5) OPCODE_ROW(X, 6) OPCODE_ROW(X, 7) \
+    OPCODE_ROW(X, 8) OPCODE_ROW(X, 9) OPCODE_ROW(X, A) OPCODE_ROW(X, B) \
+    OPCODE_ROW(X, C) OPCODE_ROW(X, D) OPCODE_ROW(X, E) OPCODE_ROW(X, F)
+
+cycles CPU::runThreaded(cycles maxCycles)
+{
+    // Interrupt dispatch, idle loops and compiled blocks are run by `cycle`,
+    // and anything watching single instructions goes through it too.
+    if(lowPowerMode || doubleReadBug || activeInterruptVector != 0x0000 || idleLoop.isSkipping() || 
+       jitEnabled || jit.hasInstalledBlocks() || isInstrumented() || verbose) return 0;
+
+    ThreadedRun run = {maxCycles, 0, memory->getIOAccessCount(), masterInterruptEnableFlag, doubleSpeedMode};
+    word instructionPC;
+    byte opcode;
+    if(!startThreadedInstruction(run, instructionPC, opcode)) return 0;
+
+    // The handler index is a constant in every target, so each one is a 
+    // direct call, and the hooks after it are specialized for its opcode.
+#ifdef CPU_COMPUTED_GOTO
+#define OPCODE_LABEL_ADDRESS(n) &&op_##n,
+#define OPCODE_LABEL(n) \
+    op_##n: \
+    INSTRUCTION_HANDLERS[0x##n](this); \
+    if(!finishThreadedInstruction(run, instructionPC, 0x##n) || !startThreadedInstruction(run, instructionPC, opcode)) return run.elapsed; \
+    goto *dispatchTable[opcode];
+    static const void* const dispatchTable[NUM_INSTRUCTIONS] = {
+        FOR_EACH_OPCODE(OPCODE_LABEL_ADDRESS)
+    };
+
+    goto *dispatchTable[opcode];
+    FOR_EACH_OPCODE(OPCODE_LABEL)
+#undef OPCODE_LABEL_ADDRESS
+#undef OPCODE_LABEL
+#else
+#define OPCODE_CASE(n) case 0x##n: INSTRUCTION_HANDLERS[0x##n](this); break;
+    // Without labels as values all the handlers share the one dispatch.
+    while(true){
+        switch (opcode)
+        {
+            FOR_EACH_OPCODE(OPCODE_CASE)
+        }
+        if(!finishThreadedInstruction(run, instructionPC, opcode) || !startThreadedInstruction(run, instructionPC, opcode)) return run.elapsed;
+    }
+#undef OPCODE_CASE
+#endif
+}
+
+#undef FOR_EACH_OPCODE
+#undef OPCODE_ROW
+
 cycles CPU::cycle(){
+    clock++;
     // If we are in low power mode do nothing.
     if(lowPowerMode){
         // If theres at least one cycle in halt, we are not effected by the double read bug.
@@ -132,19 +276,53 @@ cycles CPU::cycle(){
         // It takes 5 cycles to swap to the interrupt handler.
         if(5 > cyclesSinceLastInstuction) return 0;
         cyclesSinceLastInstuction-=5;
+        idleLoop.stop();
 
         // Push the current value of PC to the stack.
-        pushHelper(this, PC);
+        pushHelper(this, regs.PC);
         // Update PC to point to the interrupt vector.
-        PC = activeInterruptVector;
+        regs.PC = activeInterruptVector;
         // Clear the active interrupt vector.
         activeInterruptVector = 0x0000;
+        atBlockStart = true;
         // Return the 5 cycles it took to do the above work.
         return 5;
     }
 
+    // Replay the next instruction of an idle loop. If the value it reads has
+    // changed the interpreter runs it instead.
+    if(idleLoop.isSkipping()){
+        cycles stepCycles = idleLoop.nextStepCycles();
+        if(stepCycles > cyclesSinceLastInstuction) return 0;
+        if(idleLoop.replayStep(this)){
+            cyclesSinceLastInstuction = 0;
+            return stepCycles;
+        }
+    }
+
+    // Run a compiled block if one starts at PC. The whole block runs once
+    // enough cycles have been banked for all of its instructions.
+    if((jitEnabled || jit.hasInstalledBlocks()) && !doubleReadBug && !isInstrumented()){
+        const JITBlock* block = jit.lookup(memory, regs.PC);
+        if(block){
+            if(block->cycleCount > cyclesSinceLastInstuction) return 0;
+            cyclesSinceLastInstuction = 0;
+            idleLoop.stop();
+            block->code(this);
+            // A block which could not make its last memory access exits 
+            // before it with its cycles banked, the interpreter makes it now.
+            if(cyclesSinceLastInstuction != 0){
+                atBlockStart = false;
+                cycles blockCycles = block->cycleCount - cyclesSinceLastInstuction;
+                return blockCycles + fetchAndExecute();
+            }
+            atBlockStart = true;
+            return block->cycleCount;
+        }
+    }
+
     // Check the next instuction.
-    Instruction nextInstruction = instructionSet.set[memory->read(PC.read())];
+    const Instruction& nextInstruction = INSTRUCTION_SET[peekNextOpcode()];
     if(nextInstruction.cycleCount <= cyclesSinceLastInstuction){
        return fetchAndExecute();
     }
@@ -153,24 +331,100 @@ cycles CPU::cycle(){
     return 0;
 }
 
+void CPU::advance(cycles numCycles){
+    if(numCycles == 0) return;
+    clock += numCycles;
+    if(lowPowerMode){
+        setDoubleReadBug(false);
+        return;
+    }
+    if(activeInterruptVector == 0x0000 && idleLoop.isSkipping()){
+        idleLoop.advance(this, numCycles);
+        return;
+    }
+    cyclesSinceLastInstuction += doubleSpeedMode ? numCycles*2 : numCycles;
+}
+
+cycles CPU::cyclesUntilWork(){
+    if(lowPowerMode) return UINT32_MAX;
+
+    // The fewest banked cycles `cycle` could act on, checked the same way it does.
+    cycles required = 5;
+    if(activeInterruptVector == 0x0000){
+        required = INSTRUCTION_SET[peekNextOpcode()].cycleCount;
+        // A compiled block runs in place of the instruction, and only once
+        // all of its cycles are banked.
+        if((jitEnabled || jit.hasInstalledBlocks()) && !doubleReadBug && !isInstrumented()){
+            const JITBlock* block = jit.lookup(memory, regs.PC);
+            if(block) required = block->cycleCount;
+        }
+        if(idleLoop.isSkipping()) required = std::min(required, idleLoop.nextStepCycles());
+    }
+    if(cyclesSinceLastInstuction >= required) return 0;
+    cycles increment = doubleSpeedMode ? 2 : 1;
+    return (required - cyclesSinceLastInstuction - 1) / increment;
+}
+
+void CPU::computeFlags()
+{
+    bool zero = lazyFlags.result == 0;
+    bool subtract = false;
+    bool halfCarry = false;
+    bool carry = false;
+
+    switch (lazyFlags.operation)
+    {
+    case LAZY_FLAGS_ADD:
+        halfCarry = (lazyFlags.lhs & 0xF) + (lazyFlags.rhs & 0xF) > 0xF;
+        carry = lazyFlags.lhs + lazyFlags.rhs > 0xFF;
+        break;
+    case LAZY_FLAGS_SUB:
+        subtract = true;
+        halfCarry = (lazyFlags.lhs & 0xF) < (lazyFlags.rhs & 0xF);
+        carry = lazyFlags.lhs < lazyFlags.rhs;
+        break;
+    case LAZY_FLAGS_AND:
+        halfCarry = true;
+        break;
+    case LAZY_FLAGS_OR:
+        break;
+    case LAZY_FLAGS_INC:
+        halfCarry = (lazyFlags.result & 0xF) == 0;
+        carry = lazyFlags.carry;
+        break;
+    case LAZY_FLAGS_DEC:
+        subtract = true;
+        halfCarry = (lazyFlags.result & 0xF) == 0xF;
+        carry = lazyFlags.carry;
+        break;
+    default:
+        return;
+    }
+
+    // The lower 4 bits of F always read as zero.
+    regs.F = (zero << FLAG_Z) | (subtract << FLAG_N) | (halfCarry << FLAG_H) | (carry << FLAG_C);
+    lazyFlags.operation = LAZY_FLAGS_NONE;
+}
+
 void CPU::printCurrentState()
 {
+    materializeFlags();
 
     // Switch to hex notation display.
     std::cout << std::hex;
 
     std::cout << "========================" << std::endl;
-    std::cout << "AF: 0x" << (int)reg_AF.read() << std::endl;
-    std::cout << "BC: 0x" << (int)reg_BC.read() << std::endl;
-    std::cout << "DE: 0x" << (int)reg_DE.read() << std::endl;
-    std::cout << "HL: 0x" << (int)reg_HL.read() << std::endl;
-    std::cout << "\nSP: 0x" << (int)SP.read() << std::endl;
-    std::cout << "PC: 0x" << (int)PC.read() << std::endl;
-
-    std::cout << "FLAGS: Z: " << readBit(*(F), FLAG_Z)
-              << " N: " << readBit(*(F), FLAG_N)
-              << " H: " << readBit(*(F), FLAG_H)
-              << " C: " << readBit(*(F), FLAG_C) << std::endl;
+    std::cout << "AF: 0x" << (int)regs.reg_AF << std::endl;
+    std::cout << "BC: 0x" << (int)regs.reg_BC << std::endl;
+    std::cout << "DE: 0x" << (int)regs.reg_DE << std::endl;
+    std::cout << "HL: 0x" << (int)regs.reg_HL << std::endl;
+    std::cout << "\nSP: 0x" << (int)regs.SP << std::endl;
+    std::cout << "PC: 0x" << (int)regs.PC << std::endl;
+
+    std::cout << "FLAGS: Z: " << readBit(regs.F, FLAG_Z)
+              << " N: " << readBit(regs.F, FLAG_N)
+              << " H: " << readBit(regs.F, FLAG_H)
+              << " C: " << readBit(regs.F, FLAG_C) << std::endl;
 
     std::cout << "========================" << std::endl;
 
@@ -188,12 +442,8 @@ void CPU::populateCpuStateBuffer(CPU_State *CPU_StateBuffer)
     }
 
     // Populate the buffer with the CPUs current state.
-    CPU_StateBuffer->reg_AF = reg_AF.read();
-    CPU_StateBuffer->reg_BC = reg_BC.read();
-    CPU_StateBuffer->reg_DE = reg_DE.read();
-    CPU_StateBuffer->reg_HL = reg_HL.read();
-    CPU_StateBuffer->SP = SP.read();
-    CPU_StateBuffer->PC = PC.read();
+    materializeFlags();
+    *CPU_StateBuffer = regs;
 }
 
 void CPU::disableInterrupts()
@@ -220,20 +470,15 @@ void CPU::setActiveInterruptHandler(word interruptVectorAddress) {
 }
 
 void CPU::saveToState(std::ofstream & stateFile){
-    int bytesToWrite = sizeof(word)*8 + sizeof(bool)*4 + sizeof(cycles)*1;
+    int bytesToWrite = sizeof(CPU_State) + sizeof(word)*2 + sizeof(bool)*4 + sizeof(cycles)*1;
     byte* writeBuffer = new byte[
         bytesToWrite
     ];
     byte* writeBufferStart = writeBuffer;
-    word temp;
 
     // CPU Regs.
-    temp = reg_AF.read(); std::memcpy(writeBuffer, &temp, sizeof(word)); writeBuffer+=sizeof(word);
-    temp = reg_BC.read(); std::memcpy(writeBuffer, &temp, sizeof(word)); writeBuffer+=sizeof(word);
-    temp = reg_DE.read(); std::memcpy(writeBuffer, &temp, sizeof(word)); writeBuffer+=sizeof(word);
-    temp = reg_HL.read(); std::memcpy(writeBuffer, &temp, sizeof(word)); writeBuffer+=sizeof(word);
-    temp =     PC.read(); std::memcpy(writeBuffer, &temp, sizeof(word)); writeBuffer+=sizeof(word);
-    temp =     SP.read(); std::memcpy(writeBuffer, &temp, sizeof(word)); writeBuffer+=sizeof(word);
+    materializeFlags();
+    std::memcpy(writeBuffer, &regs, sizeof(CPU_State)); writeBuffer+=sizeof(CPU_State);
 
     // Other control vars.
     std::memcpy(writeBuffer, &parsedData, sizeof(word)); writeBuffer+=sizeof(word);
@@ -250,21 +495,21 @@ void CPU::saveToState(std::ofstream & stateFile){
 }
 
 void CPU::loadFromState(std::ifstream & stateFile){
-    int bytesToRead = sizeof(word)*8 + sizeof(bool)*4 + sizeof(cycles)*1;
+    int bytesToRead = sizeof(CPU_State) + sizeof(word)*2 + sizeof(bool)*4 + sizeof(cycles)*1;
     byte* readBuffer = new byte[
         bytesToRead
     ];
     byte* readBufferStart = readBuffer;
     stateFile.read((char*)readBufferStart, bytesToRead);
-    word temp;
 
     // CPU Regs.
-    std::memcpy(&temp, readBuffer, sizeof(word)); reg_AF = temp; readBuffer+=sizeof(word);
-    std::memcpy(&temp, readBuffer, sizeof(word)); reg_BC = temp; readBuffer+=sizeof(word);
-    std::memcpy(&temp, readBuffer, sizeof(word)); reg_DE = temp; readBuffer+=sizeof(word);
-    std::memcpy(&temp, readBuffer, sizeof(word)); reg_HL = temp; readBuffer+=sizeof(word);
-    std::memcpy(&temp, readBuffer, sizeof(word));     PC = temp; readBuffer+=sizeof(word);
-    std::memcpy(&temp, readBuffer, sizeof(word));     SP = temp; readBuffer+=sizeof(word);
+    std::memcpy(&regs, readBuffer, sizeof(CPU_State)); readBuffer+=sizeof(CPU_State);
+    regs.F &= 0xF0;
+    lazyFlags.operation = LAZY_FLAGS_NONE;
+    // Nothing matched before the load applies to the loaded state.
+    idleLoop.stop();
+    loopFusion.clear();
+    atBlockStart = true;
 
     // Other control vars.
     std::memcpy(&parsedData, readBuffer, sizeof(word)); readBuffer+=sizeof(word);
@@ -0,0 +1,73 @@
+/**
+ * DecodeCache class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\decodeCache.h"
+#include "include\instructionSet.h"
+#include "include\memory.h"
+
+bool DecodeCache::endsBasicBlock(byte opcode){
+    switch (opcode)
+    {
+    case JR_r8: case JR_NZ_r8: case JR_Z_r8: case JR_NC_r8: case JR_C_r8:
+    case JP_a16: case JP_NZ_a16: case JP_Z_a16: case JP_NC_a16: case JP_C_a16: case JP_HL:
+    case CALL_a16: case CALL_NZ_a16: case CALL_Z_a16: case CALL_NC_a16: case CALL_C_a16:
+    case RET: case RET_NZ: case RET_Z: case RET_NC: case RET_C: case RETI:
+    case RST_00H: case RST_08H: case RST_10H: case RST_18H:
+    case RST_20H: case RST_28H: case RST_30H: case RST_38H:
+    case HALT: case STOP:
+        return true;
+    default:
+        return false;
+    }
+}
+
+DecodeCache::~DecodeCache(){
+    clear();
+}
+
+void DecodeCache::clear(){
+    for(DecodedInstruction* bankTable : banks) delete[] bankTable;
+    banks.clear();
+}
+
+void DecodeCache::decodeBlock(Memory* memory, DecodedInstruction* bankTable, word address){
+    // The end of the 16KB region containing the block.
+    uint32_t regionEnd = (address | (ROM_BANK_SIZE - 1)) + 1;
+    uint32_t pc = address;
+
+    while(pc < regionEnd){
+        byte opcode = memory->read(pc);
+        byte length = INSTRUCTION_SET[opcode].length;
+        // Instructions with operands in the next region cannot be cached.
+        if(pc + length > regionEnd) break;
+
+        DecodedInstruction& entry = bankTable[pc & (ROM_BANK_SIZE - 1)];
+        entry.opcode = opcode;
+        entry.length = length;
+        entry.parsedData = 0;
+        if(length == 2) entry.parsedData = memory->read(pc + 1);
+        else if(length == 3) entry.parsedData = memory->read(pc + 1) | (memory->read(pc + 2) << 8);
+
+        if(endsBasicBlock(opcode)) break;
+        pc += length;
+    }
+}
+
+const DecodedInstruction* DecodeCache::lookup(Memory* memory, word address){
+    if(!isCacheable(address)) return nullptr;
+
+    // Find (or allocate) the table for the bank mapped at this address.
+    word bank = memory->getMappedROMBank(address);
+    if(bank >= banks.size()) banks.resize(bank + 1, nullptr);
+    DecodedInstruction*& bankTable = banks[bank];
+    if(bankTable == nullptr) bankTable = new DecodedInstruction[ROM_BANK_SIZE]();
+
+    DecodedInstruction* entry = &bankTable[address & (ROM_BANK_SIZE - 1)];
+    if(entry->length == 0){
+        decodeBlock(memory, bankTable, address);
+        // The instruction crosses into the next region.
+        if(entry->length == 0) return nullptr;
+    }
+    return entry;
+}
@@ -18,9 +18,15 @@ void DMAController::cycle(bool cpuDoubleSpeed){
 
     // If enough cycles passed, perform the copy.
     if(cyclesPassed == CYCLES_PER_OAM_DMA){
-        for(int i = 0; i < NUMBER_OF_ADDRESS_PER_OAM_DMA_TRANSFER; i++){
-            byte srcData = memory->read(targetAddress + i);
-            memory->write(0xFE00 + i, srcData);
+        // Copy straight into OAM unless the source has to be read through the slow path.
+        const word oamSize = OAM_END - OAM_START + 1;
+        const byte* source = memory->getReadBlock(targetAddress, oamSize);
+        if(source) std::memcpy(memory->getBytePointer(OAM_START), source, oamSize);
+        else{
+            for(int i = 0; i < NUMBER_OF_ADDRESS_PER_OAM_DMA_TRANSFER; i++){
+                byte srcData = memory->read(targetAddress + i);
+                memory->write(0xFE00 + i, srcData);
+            }
         }
         // Reset the DMA controller to prepare for the next write.
         reset();
@@ -82,24 +88,54 @@ void HDMAController::setStatus(byte data){
     transferSize = data & 0b01111111;
 
     // Do a blocking copy if generalPurpose == 0;
-    if(!generalPurpose) 
-        while(transferActive){transferChunk();}
+    if(!generalPurpose) transferChunks(transferSize + 1);
 }
 
 void HDMAController::transferChunk(){
+    transferChunks(1);
+}
+
+void HDMAController::transferChunks(int chunks){
     // No work to do. Return.
     if(!transferActive) return;
 
-    // Transfer the chunk of memory.
-    word destAddr = targetAddress + VRAM_START;
-    for(int i = 0; i < NUMBER_OF_ADDRESS_PER_HDMA_TRANSFER; i++){
-        byte srcData = memory->read(sourceAddress + i);
-        memory->write(destAddr + i, srcData);
+    // Transfer the chunks of memory as one copy if both ends are plain memory.
+    if(copyDirect(chunks * NUMBER_OF_ADDRESS_PER_HDMA_TRANSFER)){
+        finishChunks(chunks);
+        return;
+    }
+
+    // Otherwise go a chunk at a time, the source may read back the transfer's own registers.
+    for(int chunk = 0; chunk < chunks; chunk++){
+        word destAddr = targetAddress + VRAM_START;
+        for(int i = 0; i < NUMBER_OF_ADDRESS_PER_HDMA_TRANSFER; i++){
+            byte srcData = memory->read(sourceAddress + i);
+            memory->write(destAddr + i, srcData);
+        }
+        finishChunks(1);
     }
-    targetAddress += NUMBER_OF_ADDRESS_PER_HDMA_TRANSFER;
-    sourceAddress += NUMBER_OF_ADDRESS_PER_HDMA_TRANSFER;
+}
+
+bool HDMAController::copyDirect(word length){
+    // The copy has to stay inside VRAM.
+    if(targetAddress + length > VRAM_END - VRAM_START + 1) return false;
+    const byte* source = memory->getReadBlock(sourceAddress, length);
+    if(!source) return false;
+    bool vramBank = memory->getActiveVRAMBank();
+    byte* dest = memory->getVRAMBank(vramBank) + targetAddress;
+    // Copying a block onto itself byte by byte repeats bytes, leave that to the byte wise copy.
+    if(source < dest + length && dest < source + length) return false;
+
+    std::memcpy(dest, source, length);
+    memory->updateDirtyVRAM(targetAddress + VRAM_START, length, vramBank);
+    return true;
+}
+
+void HDMAController::finishChunks(int chunks){
+    targetAddress += chunks * NUMBER_OF_ADDRESS_PER_HDMA_TRANSFER;
+    sourceAddress += chunks * NUMBER_OF_ADDRESS_PER_HDMA_TRANSFER;
 
-    transferSize -= 1;
+    transferSize -= chunks;
     // Check to see when the transfer ends.
     if(transferSize == 0xFF) transferActive = false;
 }
@@ -0,0 +1,178 @@
+/**
+ * IdleLoopDetector class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\idleLoop.h"
+#include "include\cpu.h"
+#include <cstring>
+
+bool IdleLoopDetector::isSideEffectFree(byte opcode, word parsedData){
+    switch (opcode)
+    {
+    case NOP:
+    case LD_B_d8: case LD_C_d8: case LD_D_d8: case LD_E_d8: case LD_H_d8: case LD_L_d8: case LD_A_d8:
+    case INC_B: case INC_C: case INC_D: case INC_E: case INC_H: case INC_L: case INC_A:
+    case DEC_B: case DEC_C: case DEC_D: case DEC_E: case DEC_H: case DEC_L: case DEC_A:
+    case INC_BC: case INC_DE: case INC_HL: case INC_SP:
+    case DEC_BC: case DEC_DE: case DEC_HL: case DEC_SP:
+    case ADD_HL_BC: case ADD_HL_DE: case ADD_HL_HL: case ADD_HL_SP:
+    case RLCA: case RRCA: case RLA: case RRA: case DAA: case CPL: case SCF: case CCF:
+    case LD_A_mBC: case LD_A_mDE: case LD_A_mC: case LDH_A_ma8: case LD_A_ma16:
+    case ADD_A_d8: case ADC_A_d8: case SUB_d8: case SBC_A_d8: case AND_d8: case XOR_d8: case OR_d8: case CP_d8:
+    case JR_r8: case JR_NZ_r8: case JR_Z_r8: case JR_NC_r8: case JR_C_r8:
+    case JP_a16: case JP_NZ_a16: case JP_Z_a16: case JP_NC_a16: case JP_C_a16:
+        return true;
+    // These overwrite the address they read from.
+    case LD_H_mHL: case LD_L_mHL:
+        return false;
+    // Only BIT leaves (HL) untouched.
+    case PREFIX_CB:
+        return (parsedData & 0x07) != 0x06 || ((parsedData & 0xFF) >= 0x40 && (parsedData & 0xFF) <= 0x7F);
+    default:
+        // LD r,r' and LD r,(HL), but not LD (HL),r or HALT.
+        if(opcode >= LD_B_B && opcode <= LD_A_A) return opcode < LD_mHL_B || opcode > LD_mHL_A;
+        // 8 bit ALU operations on A.
+        return opcode >= ADD_A_B && opcode <= CP_A;
+    }
+}
+
+bool IdleLoopDetector::readAddress(CPU* cpu, byte opcode, word parsedData, word& address){
+    switch (opcode)
+    {
+    case LD_A_mBC: address = cpu->regs.reg_BC; return true;
+    case LD_A_mDE: address = cpu->regs.reg_DE; return true;
+    case LD_A_mC: address = 0xFF00 | cpu->regs.C; return true;
+    case LDH_A_ma8: address = 0xFF00 | (parsedData & 0xFF); return true;
+    case LD_A_ma16: address = parsedData; return true;
+    case PREFIX_CB:
+        address = cpu->regs.reg_HL;
+        return (parsedData & 0x07) == 0x06;
+    default:
+        // LD r,(HL) and the ALU operations on (HL).
+        address = cpu->regs.reg_HL;
+        return opcode >= LD_B_B && opcode <= CP_A && (opcode & 0x07) == 0x06;
+    }
+}
+
+void IdleLoopDetector::reject(){
+    rejectedHead = head;
+    hasRejectedHead = true;
+    state = IDLE_LOOP_WATCHING;
+}
+
+void IdleLoopDetector::afterInstruction(CPU* cpu, word pc, byte opcode, word parsedData){
+    if(state == IDLE_LOOP_SKIPPING) return;
+
+    bool isBranch = false;
+    switch (opcode)
+    {
+    case JR_r8: case JR_NZ_r8: case JR_Z_r8: case JR_NC_r8: case JR_C_r8:
+    case JP_a16: case JP_NZ_a16: case JP_Z_a16: case JP_NC_a16: case JP_C_a16:
+        isBranch = true;
+        break;
+    default:
+        break;
+    }
+
+    if(state == IDLE_LOOP_RECORDING){
+        // The loop was left, either through one of its branches or an interrupt.
+        word expectedPC = steps.empty() ? head : steps.back().stateAfter.PC;
+        if(pc != expectedPC || pc < head || pc > branch){
+            state = IDLE_LOOP_WATCHING;
+        } else if(!isSideEffectFree(opcode, parsedData) || steps.size() == IDLE_LOOP_MAX_INSTRUCTIONS){
+            reject();
+            return;
+        } else {
+            IdleLoopStep step;
+            step.cycleCount = INSTRUCTION_SET[opcode].cycleCount;
+            step.reads = readAddress(cpu, opcode, parsedData, step.readAddress);
+            // Reads have no side effects so this is the value the instruction saw.
+            step.readValue = step.reads ? cpu->memory->read(step.readAddress) : 0;
+            cpu->materializeFlags();
+            step.stateAfter = cpu->regs;
+            steps.push_back(step);
+
+            if(pc != branch) return;
+            // The loop exited through its last branch.
+            if(cpu->regs.PC != head){
+                state = IDLE_LOOP_WATCHING;
+                return;
+            }
+            // Back where it started with nothing changed, the loop is idle.
+            if(std::memcmp(&cpu->regs, &headState, sizeof(CPU_State)) == 0){
+                state = IDLE_LOOP_SKIPPING;
+                nextStep = 0;
+                return;
+            }
+            // Not settled yet (or counting down), record the next iteration.
+            if(++attempts >= IDLE_LOOP_MAX_ATTEMPTS){
+                reject();
+                return;
+            }
+            steps.clear();
+            headState = cpu->regs;
+            return;
+        }
+    }
+
+    // Look for a branch jumping backwards over a short body.
+    if(!isBranch) return;
+    word target = cpu->regs.PC;
+    if(target > pc || pc - target > IDLE_LOOP_MAX_INSTRUCTIONS*3) return;
+    if(hasRejectedHead && target == rejectedHead) return;
+
+    head = target;
+    branch = pc;
+    attempts = 0;
+    steps.clear();
+    cpu->materializeFlags();
+    headState = cpu->regs;
+    state = IDLE_LOOP_RECORDING;
+}
+
+bool IdleLoopDetector::isSteady(CPU* cpu){
+    for(const IdleLoopStep& step : steps){
+        if(!step.reads) continue;
+        // These change between events.
+        if(step.readAddress == 0xFF04 || step.readAddress == 0xFF05) return false;
+        if(step.readAddress >= 0xFF10 && step.readAddress <= 0xFF3F) return false;
+        if(cpu->memory->read(step.readAddress) != step.readValue) return false;
+    }
+    return true;
+}
+
+void IdleLoopDetector::advance(CPU* cpu, cycles numCycles){
+    cycles increment = cpu->doubleSpeedMode ? 2 : 1;
+    cycles& banked = cpu->cyclesSinceLastInstuction;
+    const IdleLoopStep* lastStep = nullptr;
+
+    while(true){
+        const IdleLoopStep& step = steps[nextStep];
+        // Calls to `CPU::cycle` until this step runs, at least the next one.
+        cycles wait = step.cycleCount > banked ? (step.cycleCount - banked + increment - 1) / increment : 1;
+        if(wait > numCycles){
+            banked += numCycles*increment;
+            break;
+        }
+        numCycles -= wait;
+        banked = 0;
+        skippedCycles += step.cycleCount;
+        lastStep = &step;
+        if(++nextStep == steps.size()) nextStep = 0;
+    }
+
+    if(lastStep) cpu->regs = lastStep->stateAfter;
+}
+
+bool IdleLoopDetector::replayStep(CPU* cpu){
+    const IdleLoopStep& step = steps[nextStep];
+    if(step.reads && cpu->memory->read(step.readAddress) != step.readValue){
+        stop();
+        return false;
+    }
+
+    cpu->regs = step.stateAfter;
+    skippedCycles += step.cycleCount;
+    if(++nextStep == steps.size()) nextStep = 0;
+    return true;
+}
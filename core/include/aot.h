@@ -0,0 +1,103 @@
+#ifndef AOT_H
+#define AOT_H
+/**
+ * AOT class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include "aotModule.h"
+#include <set>
+#include <string>
+#include <vector>
+
+// The platform's shared library extension.
+#ifdef _WIN32
+#define AOT_LIBRARY_EXTENSION ".dll"
+#else
+#define AOT_LIBRARY_EXTENSION ".so"
+#endif
+
+// The frames --aot-export runs a ROM for when not given, a minute of play.
+#define AOT_EXPORT_FRAMES 3600
+
+class CPU;
+class Cartridge;
+
+/**
+ * @brief Ahead-of-time recompilation of whole cartridges.
+ *
+ * `exportSource` walks the code reachable from the entry point, the RST and
+ * interrupt vectors and every block start found in an execution log, then
+ * writes one C++ function per basic block. Built as a shared library, the
+ * module is picked up by `load` the next time the cartridge is opened and its
+ * blocks are installed next to the JIT's. Any PC the module does not cover
+ * runs through the interpreter (or the JIT, if enabled).
+ *
+ * The generated blocks work on the CPU's registers directly: register to
+ * register loads, 8 bit ALU operations on A, INC and DEC and jumps are
+ * written out inline, flags included. Everything else calls the 
+ * interpreter's handler through the `AOTRuntime` interface, with PC and the
+ * immediate data only stored for the handlers which read them.
+ */
+class AOT{
+private:
+    // Block starts, packed as (bank << 16) | pc, seen while recording.
+    std::set<uint32_t> blockLog;
+
+    // The currently loaded module.
+    void* library = nullptr;
+    const AOTModule* module = nullptr;
+
+    // The functions handed to the loaded module.
+    AOTRuntime runtime = {};
+
+    /**
+     * @brief The runtime functions, see `AOTRuntime`.
+     */
+    static AOTCPUState enterBlock(CPU* cpu);
+    static void materializeFlags(CPU* cpu);
+
+public:
+    ~AOT();
+
+    /**
+     * @brief Returns the execution log recorded by the CPU.
+     */
+    std::set<uint32_t>* getBlockLog(){ return &blockLog; }
+
+    /**
+     * @brief Merges the recorded execution log into `logPath`, keeping the
+     * entries of earlier sessions.
+     *
+     * @return bool - True on success.
+     */
+    bool saveBlockLog(const std::string& logPath);
+
+    /**
+     * @brief Generates the module source for the loaded cartridge.
+     *
+     * @param cartridge - The cartridge to recompile.
+     * @param logPath - An execution log written by `saveBlockLog`, if any.
+     * @param sourcePath - The C++ file to write.
+     * @return bool - True on success.
+     */
+    bool exportSource(Cartridge* cartridge, const std::string& logPath, const std::string& sourcePath);
+
+    /**
+     * @brief Loads a compiled module and installs its blocks into the CPU.
+     * Fails if the module was generated from a different ROM.
+     *
+     * @param libraryPath - The shared library to load.
+     * @param cpu - The CPU to install the blocks into.
+     * @param cartridge - The loaded cartridge.
+     * @return bool - True if a module was loaded.
+     */
+    bool load(const std::string& libraryPath, CPU* cpu, Cartridge* cartridge);
+
+    /**
+     * @brief Unloads the current module. The CPU's compiled blocks must be
+     * cleared first.
+     */
+    void unload();
+};
+
+#endif
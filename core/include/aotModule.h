@@ -0,0 +1,117 @@
+#ifndef AOTMODULE_H
+#define AOTMODULE_H
+/**
+ * The interface between the emulator and ahead-of-time compiled ROM modules.
+ * This header is included by the generated module sources so it must stay
+ * self contained.
+ */
+#include <cstdint>
+
+// Bumped whenever the structures or helpers below change.
+#define AOT_MODULE_VERSION 3
+// The name of the function every module exports.
+#define AOT_MODULE_SYMBOL "gbAOTModule"
+
+class CPU;
+
+typedef uint32_t (*AOTHandler)(CPU*);
+
+// The CPU's register file, laid out as the emulator's `CPU_State`: each 16
+// bit pair overlaps its two 8 bit halves, low byte first.
+struct AOTRegisters{
+    union { uint16_t AF; struct { uint8_t F; uint8_t A; }; };
+    union { uint16_t BC; struct { uint8_t C; uint8_t B; }; };
+    union { uint16_t DE; struct { uint8_t E; uint8_t D; }; };
+    union { uint16_t HL; struct { uint8_t L; uint8_t H; }; };
+    uint16_t PC;
+    uint16_t SP;
+};
+
+// The parts of a CPU the generated code works on directly.
+struct AOTCPUState{
+    AOTRegisters* regs;
+    // The immediate data read by the handler called next.
+    uint16_t* parsedData;
+};
+
+// Functions the emulator hands to a module when it is loaded.
+struct AOTRuntime{
+    // Writes any flags still pending to F and returns the CPU's state. Called
+    // when a block starts.
+    AOTCPUState (*enterBlock)(CPU* cpu);
+    // Writes any flags a handler left pending to F, before the block's own
+    // code reads or writes it.
+    void (*materializeFlags)(CPU* cpu);
+    // The emulator's instruction handlers indexed by opcode, called for
+    // everything the generated code does not do itself.
+    const AOTHandler* handlers;
+};
+
+// The bits of F.
+#define AOT_FLAG_Z 0x80
+#define AOT_FLAG_N 0x40
+#define AOT_FLAG_H 0x20
+#define AOT_FLAG_C 0x10
+
+// The 8 bit ALU operations on A, setting F the way the emulator's handlers do.
+static inline void aotAdd(AOTRegisters* r, uint8_t value, bool carry){
+    unsigned result = r->A + value + carry;
+    bool halfCarry = (r->A & 0xF) + (value & 0xF) + carry > 0xF;
+    r->A = (uint8_t)result;
+    r->F = (r->A == 0 ? AOT_FLAG_Z : 0) | (halfCarry ? AOT_FLAG_H : 0) | (result > 0xFF ? AOT_FLAG_C : 0);
+}
+// Subtracts `value` from A, only keeping the result if `store` is set (CP).
+static inline void aotSub(AOTRegisters* r, uint8_t value, bool carry, bool store){
+    uint8_t result = r->A - value - carry;
+    bool halfCarry = (r->A & 0xF) < (value & 0xF) + carry;
+    bool borrow = r->A < value + carry;
+    r->F = (result == 0 ? AOT_FLAG_Z : 0) | AOT_FLAG_N | (halfCarry ? AOT_FLAG_H : 0) | (borrow ? AOT_FLAG_C : 0);
+    if(store) r->A = result;
+}
+static inline void aotAnd(AOTRegisters* r, uint8_t value){
+    r->A &= value;
+    r->F = (r->A == 0 ? AOT_FLAG_Z : 0) | AOT_FLAG_H;
+}
+static inline void aotXor(AOTRegisters* r, uint8_t value){
+    r->A ^= value;
+    r->F = r->A == 0 ? AOT_FLAG_Z : 0;
+}
+static inline void aotOr(AOTRegisters* r, uint8_t value){
+    r->A |= value;
+    r->F = r->A == 0 ? AOT_FLAG_Z : 0;
+}
+// INC and DEC of an 8 bit register keep the carry flag.
+static inline void aotInc(AOTRegisters* r, uint8_t& reg){
+    reg++;
+    r->F = (r->F & AOT_FLAG_C) | (reg == 0 ? AOT_FLAG_Z : 0) | ((reg & 0xF) == 0 ? AOT_FLAG_H : 0);
+}
+static inline void aotDec(AOTRegisters* r, uint8_t& reg){
+    reg--;
+    r->F = (r->F & AOT_FLAG_C) | (reg == 0 ? AOT_FLAG_Z : 0) | AOT_FLAG_N | ((reg & 0xF) == 0xF ? AOT_FLAG_H : 0);
+}
+
+// A compiled basic block starting at (bank, pc).
+struct AOTBlock{
+    uint16_t bank;
+    uint16_t pc;
+    // The sum of the cycle counts of every instruction in the block.
+    uint32_t cycleCount;
+    // Runs the block on the given CPU. Modules are shared by every core that
+    // loads them so blocks keep no CPU of their own.
+    void (*code)(CPU* cpu);
+};
+
+// Everything a module exports.
+struct AOTModule{
+    uint32_t version;
+    // The global checksum of the ROM the module was generated from.
+    uint16_t romChecksum;
+    uint32_t blockCount;
+    const AOTBlock* blocks;
+    // Called before any block runs. The runtime is the same for every core.
+    void (*bind)(const AOTRuntime* runtime);
+};
+
+typedef const AOTModule* (*AOTModuleEntry)();
+
+#endif
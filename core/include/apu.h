@@ -5,8 +5,10 @@
  */
 #include "defines.h"
 #include "audioDefines.h"
+#include <atomic>
 
 class APU;
+class MemoryArena;
 /**
  * Base class for the GBs audio channels.
 */
@@ -516,6 +518,9 @@ private:
     uint32_t readLocation = 0;
     uint32_t writeLocation = 0;
     AudioChannelData* audioData = nullptr;
+    // Set by `resyncAudio`, applied by the audio thread on its next fetch so
+    // only it ever moves the read position.
+    std::atomic<bool> resyncPending{false};
 
     // Keeps track of the "cycle currency" the APU can spend.
     cycles cyclesCounter = 0;
@@ -543,12 +548,22 @@ public:
      */
     AudioChannelData* fetchAudioData();
     /**
-     * @brief Dynamically allocates all blocks
-     * of memory. Returns a bool indicating success.
+     * @brief Moves the read position to a buffer behind the write position,
+     * dropping any audio made faster than it was played. Safe to call off
+     * the audio thread, it takes effect on the next fetch.
      */
-    bool init();
+    void resyncAudio();
     /**
-     * @brief Deallocates all dynamic memory.
+     * @brief Takes all blocks of memory from `arena`. 
+     * Returns a bool indicating success.
+     */
+    bool init(MemoryArena& arena);
+    /**
+     * @brief Returns the number of arena bytes `init` takes.
+     */
+    static size_t arenaSize();
+    /**
+     * @brief Drops all blocks of memory, the arena they came from frees them.
      */
     void destroy();
     /**
@@ -575,6 +590,12 @@ public:
      * @param divAPUEvents the current state of the “DIV-APU” counter.
      */
     void cycle(byte divAPUEvents);
+
+    /**
+     * @brief Perform the work of `numCycles` clock cycles without any
+     * “DIV-APU” events.
+     */
+    void advance(cycles numCycles);
     
     /**
      * @brief Write to one of the APU's registers. Note for speed the 
@@ -0,0 +1,82 @@
+#ifndef BATTERYSAVE_H
+#define BATTERYSAVE_H
+/**
+ * BatterySave class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// How often, in milliseconds, battery backed RAM is written out if it changed.
+#define BATTERY_SAVE_FLUSH_INTERVAL_MS 1000
+
+/**
+ * @brief Keeps a cartridge's battery backed RAM in step with its save file.
+ *
+ * The emulator writes RAM directly, with no file access per store. A
+ * background thread compares RAM against what was last saved every flush
+ * interval and, if it changed, writes a new save file. Saves are written
+ * to a temporary file which is flushed to disk and then renamed over the
+ * save, so a crash part way through leaves the previous save intact.
+ */
+class BatterySave{
+private:
+    byte* ram = nullptr;
+    uint32_t ramSize = 0;
+    std::string filePath;
+    // The RAM contents in the save file.
+    std::vector<byte> saved;
+    // Held while comparing and writing out `saved`.
+    std::mutex saveMutex;
+
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool running = false;
+    int flushInterval = BATTERY_SAVE_FLUSH_INTERVAL_MS;
+
+    /**
+     * @brief The writer thread's main loop.
+     */
+    void flushPeriodically();
+    /**
+     * @brief Writes `saved` to the save file. Returns false on failure.
+     */
+    bool writeSaveFile();
+
+public:
+    ~BatterySave(){ stop(); }
+
+    /**
+     * @brief Loads `d_filePath` into `d_ram`, creating the file if it does
+     * not exist, and starts the writer thread.
+     */
+    void start(const std::string& d_filePath, byte* d_ram, uint32_t d_ramSize);
+
+    /**
+     * @brief Writes out any unsaved changes and stops the writer thread.
+     */
+    void stop();
+
+    /**
+     * @brief Writes the save file now if RAM changed since it was last written.
+     */
+    void flush();
+
+    /**
+     * @brief Copies `length` bytes of `data` into RAM at `offset`, under the
+     * lock `flush` copies RAM with, so a partly written value is never saved.
+     * Returns false if not started or the range is outside RAM.
+     */
+    bool update(uint32_t offset, const byte* data, uint32_t length);
+
+    /**
+     * @brief Sets how often, in milliseconds, changes are written out.
+     */
+    void setFlushInterval(int milliseconds);
+};
+
+#endif
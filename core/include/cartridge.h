@@ -6,6 +6,8 @@ Cartridge class for loading .gb rom files
 date: 2022-05-14
 */
 #include "defines.h"
+#include "mappedFile.h"
+#include "batterySave.h"
 #include <fstream>
 #include <string>
 #include <filesystem> 
@@ -14,6 +16,14 @@ date: 2022-05-14
 class Memory;
 class Core;
 
+// The layout of a saved clock, a magic number followed by the clock registers
+// and the two timestamps.
+#define RTC_SAVE_MAGIC 0x32435452 // "RTC2"
+#define RTC_REGISTERS_OFFSET sizeof(uint32_t)
+#define RTC_TIMESTAMPS_OFFSET (RTC_REGISTERS_OFFSET + sizeof(byte)*4 + sizeof(bool)*3)
+#define RTC_TIMESTAMPS_SIZE (sizeof(long long)*2)
+#define RTC_SAVE_SIZE (RTC_TIMESTAMPS_OFFSET + RTC_TIMESTAMPS_SIZE)
+
 class RTC {
 	private:
 		// The value currently held in the clock;
@@ -26,13 +36,43 @@ class RTC {
 		bool halt = 0;
 		bool carry = 0;
 
-		// The unix timestamp of when the clock value was last saved.
+		// The time, according to `timeSource`, of when the clock value was last saved.
+		// Saved to file against the wall clock instead.
 		long long lastSaved = 0;
 		long long valueSaved = 0;
 
 		std::string targetClockName;
 
-		std::fstream clockFile;
+		// Returns the current time in seconds. The host's wall clock if empty.
+		rtcTimeSourceFunctionTemplate timeSource;
+
+		// The clock as it is saved, written out in the background by `clockSave`.
+		// Only written through `clockSave.update` while it is running.
+		byte clockData[RTC_SAVE_SIZE] = {};
+		BatterySave clockSave;
+
+		/**
+		 * @brief Returns the current time in seconds from the time source.
+		 */
+		long long currentTime();
+		/**
+		 * @brief Returns the number of seconds the clock holds at `currTime`.
+		 */
+		long long clockValue(long long currTime);
+		/**
+		 * @brief Saves the clock's value at `currTime` to `clockData`.
+		 */
+		void saveTimestamps(long long currTime);
+		/**
+		 * @brief Writes the clock's value at `currTime` into `buffer` as it
+		 * is laid out in `clockData`, `RTC_TIMESTAMPS_SIZE` bytes.
+		 */
+		void packTimestamps(byte* buffer, long long currTime);
+		/**
+		 * @brief Writes the whole clock into `buffer` as it is laid out in
+		 * `clockData`, `RTC_SAVE_SIZE` bytes.
+		 */
+		void packClock(byte* buffer);
 
 	public:
 		void syncToCartridge(std::string cartridgeName);
@@ -43,8 +83,25 @@ class RTC {
 		byte readLatchedData(int targetReg);
 		void writeToClock(int targetReg, byte data);
 
-		void saveClockToFile(bool partial = false);
-		void loadClockFromFile();
+		/**
+		 * @brief Saves the clock and writes it out now.
+		 */
+		void saveClock();
+		/**
+		 * @brief Restores the clock to how it was last saved.
+		 */
+		void loadClock();
+
+		/**
+		 * @brief Changes where the clock gets the time from. The clock
+		 * carries on from the value it holds under the old source.
+		 */
+		void setTimeSource(rtcTimeSourceFunctionTemplate source);
+
+		/**
+		 * @brief Sets how often, in milliseconds, the clock is written out.
+		 */
+		void setSaveInterval(int milliseconds){ clockSave.setFlushInterval(milliseconds); }
 };
 
 class Cartridge {
@@ -85,12 +142,24 @@ private:
 
 	std::ifstream romFile;
 
-	std::fstream ramFile;
+	BatterySave batterySave;
 
 	byte* headerDataBuffer = nullptr;
-	byte* romData = nullptr;
+	// Points into `romMapping`, or `romBuffer` if the ROM could not be mapped.
+	const byte* romData = nullptr;
+	MappedFile romMapping;
+	byte* romBuffer = nullptr;
 	byte* externalRAM = nullptr;
 
+	// The banks currently switched in by the memory controller's registers,
+	// recomputed by `updateBanks` whenever they change.
+	word romBank0Number = 0;
+	word romBankNNumber = 1;
+	const byte* romBank0 = nullptr;
+	const byte* romBankN = nullptr;
+
+	Memory* memory = nullptr;
+
 	bool romLoaded = false;
 	bool usingBattery = false;
 	bool usingRTC = false;
@@ -127,6 +196,20 @@ public:
 	 */
 	void close();
 
+	/**
+	 * @brief Sets how often, in milliseconds, battery backed RAM and the real
+	 * time clock are written out.
+	*/
+	void setBatterySaveInterval(int milliseconds){
+		batterySave.setFlushInterval(milliseconds);
+		realTimeClock.setSaveInterval(milliseconds);
+	}
+	/**
+	 * @brief Sets where the real time clock gets the time from, the host's
+	 * wall clock if `source` is empty.
+	*/
+	void setRTCTimeSource(rtcTimeSourceFunctionTemplate source){ realTimeClock.setTimeSource(source); }
+
 	/**
 	 * Accessors for the currently loaded cartridge. Note, these will return
 	 * the most recent cartridge in the case that the cartridge is removed.
@@ -142,6 +225,11 @@ public:
 	std::string getManufacturerCode(){ return std::string((char*) manufacturerCode);}
 	std::string getLicenseeCode(){ return oldLicenseCode == 0x33 ? std::string((char*) newLicenseCode) : std::to_string((int) oldLicenseCode);}
 	std::string getCartridgeName(){ return cartridgeName;}
+	/**
+	 * @brief Returns the byte at `offset` into the ROM, or HIGH_IMPEDANCE past its end.
+	*/
+	byte readROMByte(uint32_t offset){ return offset < romSize ? romData[offset] : HIGH_IMPEDANCE; }
+	uint32_t getROMSize(){ return romSize; }
 	/**
 	 * @brief Helper function to convert large number into human readable forms.
 	 * EX 32768 -> 32KB.
@@ -160,26 +248,37 @@ public:
 	*/
 	void setUpRAMBatteryFile();
 
+	/**
+	 * @brief Works out which ROM and RAM banks the memory controller's
+	 * registers select and hands them to the memory map. Called after
+	 * every register write so reads never have to repeat the work.
+	*/
+	void updateBanks();
+
 	// Memory Controllers.
 	byte noMemoryControllerRead(word address);
 	void noMemoryControllerWrite(word address, byte data);
 	void noMemoryControllerSaveToState(std::ofstream & stateFile);
 	void noMemoryControllerLoadFromState(std::ifstream & stateFile);
+	word noMemoryControllerROMBank(word address);
 
 	byte controllerMCB1Read(word address);
 	void controllerMCB1Write(word address, byte data);
 	void controllerMCB1SaveToState(std::ofstream & stateFile);
 	void controllerMCB1LoadFromState(std::ifstream & stateFile);
+	word controllerMCB1ROMBank(word address);
 
 	byte controllerMCB3Read(word address);
 	void controllerMCB3Write(word address, byte data);
 	void controllerMCB3SaveToState(std::ofstream & stateFile);
 	void controllerMCB3LoadFromState(std::ifstream & stateFile);
+	word controllerMCB3ROMBank(word address);
 
 	byte controllerMCB5Read(word address);
 	void controllerMCB5Write(word address, byte data);
 	void controllerMCB5SaveToState(std::ofstream & stateFile);
 	void controllerMCB5LoadFromState(std::ifstream & stateFile);
+	word controllerMCB5ROMBank(word address);
 };
 
 
@@ -7,6 +7,7 @@ The header declaration for the main emulator core.
 #include <wx/wxprec.h>
 #include <string>
 #include <mutex> 
+#include <atomic>
 
 #include "SDL.h"
 
@@ -20,12 +21,19 @@ The header declaration for the main emulator core.
 #include "defines.h"
 #include "audioDefines.h"
 #include "cartridge.h"
+#include "aot.h"
+#include "profiler.h"
+#include "traceRecorder.h"
+#include "memoryArena.h"
+#include "scheduler.h"
 #include "sdlController.h"
 #include "../../GUI/include/app.h"
 #include <filesystem> 
 
 class Core{
 private:
+    // Holds the memory of every component below, declared first so it outlives them.
+    MemoryArena arena;
     CPU cpu;
     Memory memory;
     Cartridge cartridge;
@@ -33,8 +41,15 @@ private:
     IOController ioController; 
     APU apu; 
 
+    // Ahead-of-time compiled code for the loaded cartridge.
+    AOT aot;
+    bool aotRecording = false;
+
     ExecutionModes executionMode = PAUSE;
 
+    // Set once the constructor has allocated and set up all of the hardware.
+    bool initialized = false;
+
     std::mutex mtx;
 
     // Controls when to break CPU execution. Values are of requested PC values to break on.
@@ -45,14 +60,61 @@ private:
 
     // Placeholder for no audio.
     AudioChannelData NO_AUDIO = {};
+    // While set, silence is played in place of the APU's output. Read by the audio thread.
+    std::atomic<bool> audioMuted{false};
+
+    // The number of whole frames run since the core was created.
+    uint64_t framesEmulated = 0;
+
+    // While set, the hardware jumps straight to the next event whenever the
+    // CPU is only waiting for an interrupt.
+    bool waitSkipEnabled = true;
+
+    // The master cycle count and when the hardware next needs to run.
+    Scheduler scheduler;
+
+    /**
+     * @brief Schedules the next PPU, timer and interrupt events from the
+     * hardware's current state.
+     */
+    void scheduleHardwareEvents();
+
+    // Counts the instructions run while profiling is enabled.
+    Profiler profiler;
+    bool profilingEnabled = false;
+
+    /**
+     * @brief Writes the profile of the current game into the profiles
+     * directory, both as CSV and JSON. The caller must hold the mutex lock.
+     */
+    void writeProfileReports();
+
+    // Writes the trace of the current game while tracing.
+    TraceRecorder traceRecorder;
+    bool compressTraces = true;
+
+    /**
+     * @brief Stops tracing and closes the trace file. The caller must hold
+     * the mutex lock.
+     */
+    void stopTrace();
 
 public:
     // Make the core's controller public so that the rest of the codebase can modify bindings without needing wrapper functions.
     SDLController controller;
 
+    /**
+     * @brief Sets up the emulated hardware. Check `isInitialized` before
+     * using the core, it is left unusable if its memory cannot be allocated.
+    */
     Core(ExecutionModes mode);
     ~Core();
 
+    /**
+     * @brief Returns true if the core was set up successfully.
+    */
+    bool isInitialized(){ return initialized; }
+
     /**
      * @brief Sets up the initial state of the emulator.
     */
@@ -77,6 +139,13 @@ public:
      */
     Memory* getMemory(){ return &memory;}
 
+    /**
+     * @brief An accessor function for retrieving the CPU sub-object.
+     * 
+     * @returns CPU*.
+     */
+    CPU* getCPU(){ return &cpu;}
+
     /**
      * @brief An accessor function for retrieving the IO joypad.
      * 
@@ -102,6 +171,28 @@ public:
      */
     void runForFrame(bool breakOnCPU);
 
+    /**
+     * @brief Enables or disables skipping ahead to the next hardware event
+     * while the CPU is halted or spinning in an idle loop.
+     */
+    void setWaitSkipEnabled(bool state){ waitSkipEnabled = state; }
+    /**
+     * @brief Selects how the CPU dispatches instructions, see `CPU::runThreaded`.
+     * Breakpoints and stepping always run single instructions.
+     */
+    void setDispatchMode(CPUDispatchModes mode);
+    /**
+     * @brief Enables or disables the recompiler, see `JIT`. While enabled
+     * the CPU runs compiled blocks in place of threaded dispatch.
+     */
+    void setJITEnabled(bool state);
+
+    /**
+     * @brief Returns the number of whole frames run since the core was
+     * created. Used to measure the emulation speed.
+     */
+    uint64_t getFramesEmulated(){ return framesEmulated; }
+
     /**
      * @brief Dumps all important emulation states to stdio.
      * 
@@ -176,6 +267,81 @@ public:
      */
     LoadCartridgeReturnCodes loadROM(std::string filePath);
 
+    /**
+     * @brief Starts or stops recording which ROM basic blocks are executed.
+     * The recording is used by `exportAOTModule` to find code which cannot be
+     * discovered statically (ie code in switchable ROM banks).
+     * 
+     * @param state True to start recording.
+     */
+    void setAOTRecording(bool state);
+    /**
+     * @brief Returns true while recording for `exportAOTModule`.
+     */
+    bool isAOTRecording(){ return aotRecording; }
+
+    /**
+     * @brief Writes the execution log and the ahead-of-time compiled module
+     * source for the current game into the AOT directory. Once built into a
+     * shared library there (see scripts/buildAOTModule), the module is 
+     * loaded with the ROM.
+     * 
+     * @return bool - True on success.
+     */
+    bool exportAOTModule();
+    /**
+     * @brief Runs `romPath` without the GUI for `frames` frames while 
+     * recording for `exportAOTModule`, then exports its module. Used by the
+     * --aot-export command line option. Returns 0 on success.
+     */
+    static int runAOTExport(const std::string& romPath, int frames);
+
+    /**
+     * @brief Starts or stops counting the executions and cycles of every
+     * instruction, see `Profiler`. The counts are kept until reset and are
+     * written out when the game is closed. Has no effect if the emulator
+     * was built without CPU_PROFILER.
+     */
+    void setProfilingEnabled(bool state);
+    /**
+     * @brief Returns true while profiling.
+     */
+    bool isProfilingEnabled(){ return profilingEnabled; }
+    /**
+     * @brief Writes the current profile into the profiles directory.
+     */
+    void saveProfile();
+    /**
+     * @brief Clears the current profile.
+     */
+    void resetProfile();
+    /**
+     * @brief Returns the `count` addresses which took the most cycles along
+     * with the total number of cycles profiled.
+     */
+    std::vector<ProfileHotSpot> getProfileHotSpots(size_t count, uint64_t* totalCycles);
+
+    /**
+     * @brief Starts or stops writing a binary trace of every instruction to
+     * the traces directory, see `TraceRecorder`. Starting a new trace
+     * overwrites the last one of the current game.
+     */
+    void setTracing(bool state);
+    /**
+     * @brief Returns true while tracing.
+     */
+    bool isTracing(){ return traceRecorder.isRecording(); }
+    /**
+     * @brief Sets whether traces started from now on are delta compressed.
+     */
+    void setTraceCompression(bool state){ compressTraces = state; }
+
+    /**
+     * @brief Sets where the cartridge's real time clock gets the time from.
+     * `fixedTime`, in seconds, is the time RTC_FIXED_TIME holds the clock at.
+     */
+    void setRTCTimeSource(RTCTimeSources source, long long fixedTime = 0);
+
     /**
      * @brief The logic for when the TIMA timer 
      * overflows.
@@ -192,15 +358,27 @@ public:
      * with audio data.
      */
     AudioChannelData* fetchAudioData(){
-        if(executionMode == PAUSE) return (&NO_AUDIO);
+        if(executionMode == PAUSE || audioMuted) return (&NO_AUDIO);
         return apu.fetchAudioData();
     }
+    /**
+     * @brief Mutes or unmutes the audio, ie while running faster than it can
+     * be played. Unmuting drops any audio made while muted.
+     */
+    void setAudioMuted(bool state){
+        audioMuted = state;
+        if(!audioMuted) apu.resyncAudio();
+    }
 
 
     /**
      * @brief Returns the currently loaded cartridge.
     */
     Cartridge* getCartridge(){ return &cartridge;}
+    /**
+     * @brief Returns the arena holding all of the emulated hardware's memory.
+    */
+    MemoryArena* getMemoryArena(){ return &arena;}
 
     /**
      * @brief Checks the CPU's master interrupt flag along with the enable interrupt 
@@ -7,7 +7,14 @@
 #include "memory.h"
 #include "register.h"
 #include "instructionSet.h"
+#include "decodeCache.h"
+#include "jit.h"
+#include "idleLoop.h"
+#include "loopFusion.h"
+#include "profiler.h"
+#include "traceRecorder.h"
 #include <vector>
+#include <set>
 #include <fstream>
 
 /**
@@ -18,7 +25,7 @@
  * @param cpu - The CPU running this instruction.
  * @param dest - The register to pop from stack into.
  */
-void popHelper(CPU* cpu, reg& dest);
+void popHelper(CPU* cpu, word& dest);
 
 /**
  * @brief  A generic function used to implement the push instructions. 
@@ -29,7 +36,31 @@ void popHelper(CPU* cpu, reg& dest);
  * @param cpu - The CPU running this instruction.
  * @param source - The register to push into the stack.
  */
-void pushHelper(CPU* cpu, reg& source);
+void pushHelper(CPU* cpu, word source);
+
+class Scheduler;
+class APU;
+
+// The progress of a `runThreaded` call, and what it has to stop for.
+struct ThreadedRun{
+    cycles maxCycles;
+    // Calls to `cycle` accounted for so far.
+    cycles elapsed;
+    // Changes to any of these may change when the next hardware event is due.
+    uint32_t ioAccesses;
+    bool interruptsEnabled;
+    bool doubleSpeed;
+};
+
+// The operands and result of the last ALU operation whose flags are pending.
+struct LazyFlags{
+    byte operation;
+    byte lhs;
+    byte rhs;
+    byte result;
+    // The carry flag from before an INC or DEC, which both leave it untouched.
+    bool carry;
+};
 
 class CPU {
 
@@ -39,8 +70,13 @@ class CPU {
     friend class LoadAndStore;
     friend class Bit;
     friend class Arithmetic;
-    friend void popHelper(CPU*, reg&);
-    friend void pushHelper(CPU*, reg&);
+    friend class JIT;
+    friend class AOT;
+    friend class IdleLoopDetector;
+    friend class LoopFusion;
+    friend class InstructionHarness;
+    friend void popHelper(CPU*, word&);
+    friend void pushHelper(CPU*, word);
 
 private:
     // A flag used to determine whether debug messages are printed to console.
@@ -52,37 +88,135 @@ private:
     // A flag to handle the double read coming out of halt.
     bool doubleReadBug = false;
     
-    // Main Registers. 
-    reg reg_AF;
-    reg reg_BC;
-    reg reg_DE;
-    reg reg_HL;
+    // The register file: AF, BC, DE, HL, PC and SP packed together with 
+    // their 8 bit halves. Aligned so it never straddles a cache line.
+    alignas(16) CPU_State regs;
 
-    // 8bit addressable versions of the above registers. 
-    reg8 A = reg_AF.getHighPtr();
-    reg8 F = reg_AF.getLowPtr();
+    // A word to hold the parsed intermediate data from instructions. 
+    word parsedData;
 
-    reg8 B = reg_BC.getHighPtr();
-    reg8 C = reg_BC.getLowPtr();
+    // Pre-decoded basic blocks of the loaded ROM.
+    DecodeCache decodeCache;
+    bool decodeCacheEnabled = true;
 
-    reg8 D = reg_DE.getHighPtr();
-    reg8 E = reg_DE.getLowPtr();
+    // Recompiled hot basic blocks.
+    JIT jit;
+    bool jitEnabled = false;
+    // Set when the next instruction starts a basic block.
+    bool atBlockStart = true;
+    // If set, every basic block start reached in ROM is logged here as (bank << 16) | pc.
+    std::set<uint32_t>* blockStartLog = nullptr;
 
-    reg8 H = reg_HL.getHighPtr();
-    reg8 L = reg_HL.getLowPtr();
+    // Replays side effect free polling loops without interpreting them.
+    IdleLoopDetector idleLoop;
+    bool idleLoopSkipEnabled = true;
 
-    // Stack pointer and program counter registers.
-    reg SP;
-    reg PC;
+    // Runs recognized copy and fill loops in bulk.
+    LoopFusion loopFusion;
+    bool loopFusionEnabled = true;
 
-    // A word to hold the parsed intermediate data from instructions. 
-    word parsedData;
+#ifdef CPU_PROFILER
+    // If set, every instruction run is counted here.
+    Profiler* profiler = nullptr;
+#endif
+
+    // If set, every instruction run is traced here.
+    TraceRecorder* traceRecorder = nullptr;
+    // Calls to `cycle` since the CPU was reset, used to timestamp traces.
+    uint64_t clock = 0;
+
+    /**
+     * @brief Returns true if something must see every instruction run, ie
+     * the profiler or a trace. Compiled blocks, idle loops and fused loops
+     * are then interpreted.
+     */
+    bool isInstrumented(){
+#ifdef CPU_PROFILER
+        if(profiler) return true;
+#endif
+        return traceRecorder != nullptr;
+    }
+
+    // The engine used to dispatch decoded opcodes to their handlers.
+    CPUDispatchModes dispatchMode = CPU_DEFAULT_DISPATCH_MODE;
+
+    // Flags of the last 8 bit ALU operation, not yet written to F.
+    LazyFlags lazyFlags = {LAZY_FLAGS_NONE, 0, 0, 0, false};
+    bool lazyFlagsEnabled = true;
 
-    // All the instructions executable by the CPU; 
-    InstructionSet instructionSet;
+    /**
+     * @brief Records the operands and result of an 8 bit ALU operation in 
+     * place of updating F. The flags are only computed once something reads
+     * F, see `materializeFlags`. INC and DEC keep the current carry flag.
+     * 
+     * @param operation - The kind of operation which ran.
+     * @param lhs - The value of the first operand.
+     * @param rhs - The value of the second operand.
+     * @param result - The 8 bit result of the operation.
+     */
+    void deferFlags(LazyFlagOperations operation, byte lhs, byte rhs, byte result){
+        bool carry = false;
+        if(operation == LAZY_FLAGS_INC || operation == LAZY_FLAGS_DEC) carry = readCarryFlag();
+        lazyFlags = {(byte)operation, lhs, rhs, result, carry};
+        if(!lazyFlagsEnabled) computeFlags();
+    }
+
+    /**
+     * @brief Returns the carry flag without materializing the pending flags.
+     */
+    bool readCarryFlag(){
+        switch (lazyFlags.operation)
+        {
+        case LAZY_FLAGS_NONE: return readBit(regs.F, FLAG_C);
+        case LAZY_FLAGS_ADD: return lazyFlags.lhs + lazyFlags.rhs > 0xFF;
+        case LAZY_FLAGS_SUB: return lazyFlags.lhs < lazyFlags.rhs;
+        case LAZY_FLAGS_INC: case LAZY_FLAGS_DEC: return lazyFlags.carry;
+        default: return false;
+        }
+    }
+
+    /**
+     * @brief Writes the flags of the pending ALU operation into F.
+     */
+    void computeFlags();
+
+    /**
+     * @brief Reads the next instruction, from `decoded` if it was found in 
+     * the decode cache, moving PC past it and loading `parsedData`. Returns
+     * its opcode.
+     */
+    byte fetchInstruction(const DecodedInstruction* decoded);
+    /**
+     * @brief Runs the hooks which watch for idle and fusible loops after the
+     * instruction at `instructionPC` ran.
+     */
+    void afterInstruction(word instructionPC, byte opcode){
+        if(idleLoopSkipEnabled) idleLoop.afterInstruction(this, instructionPC, opcode, parsedData);
+        if(loopFusionEnabled && opcode == JR_NZ_r8 && regs.PC < instructionPC) loopFusion.onBackwardBranch(this, regs.PC);
+    }
+
+    /**
+     * @brief Fetches the next instruction of a `runThreaded` call, once the
+     * hardware has been run up to the cycle it is due on. Returns false,
+     * having changed nothing, if it is not due before the run has to end.
+     */
+    bool startThreadedInstruction(ThreadedRun& run, word& instructionPC, byte& opcode);
+    /**
+     * @brief Finishes the cycle an instruction of a `runThreaded` call ran
+     * on. Returns false if the run has to stop after it.
+     */
+    bool finishThreadedInstruction(ThreadedRun& run, word instructionPC, byte opcode);
+    /**
+     * @brief Runs the scheduler and APU for `numCycles`, as `Core` does 
+     * between instructions.
+     */
+    void advanceHardware(cycles numCycles);
 
     // A pointer to memory. 
     Memory* memory = nullptr;
+    // The hardware `runThreaded` keeps in step, see `bindHardware`.
+    Scheduler* scheduler = nullptr;
+    APU* apu = nullptr;
     
     // A bool indicating the CPU is operating using the double speed clock,
     bool doubleSpeedMode = false;
@@ -118,6 +252,48 @@ public:
      * @brief Set's the CPU's low power mode flag.
      */
     void setLowPowerMode(bool state){lowPowerMode = state;}
+    /**
+     * @brief Returns true while the CPU is halted or stopped.
+     */
+    bool getLowPowerMode(){ return lowPowerMode; }
+
+    /**
+     * @brief Returns true if the CPU only waits for an interrupt, either 
+     * halted or spinning in a steady idle loop, and does nothing the rest of
+     * the hardware can observe until then.
+     */
+    bool isWaiting(){ return activeInterruptVector == 0x0000 && (lowPowerMode || (idleLoop.isSkipping() && idleLoop.isSteady(this))); }
+    /**
+     * @brief Does the work of `numCycles` calls to `cycle` while `isWaiting`,
+     * or while no more than `cyclesUntilWork`.
+     */
+    void advance(cycles numCycles);
+    /**
+     * @brief Returns how many calls to `cycle` will only bank cycles before 
+     * one runs an instruction, compiled block or interrupt dispatch. 
+     * UINT32_MAX while in low power mode, only an interrupt ends it.
+     */
+    cycles cyclesUntilWork();
+
+    /**
+     * @brief Returns true if the CPU has just branched back to the head of a
+     * copy or fill loop which `runFusedLoop` can run in bulk.
+     */
+    bool atFusibleLoop(){ return loopFusion.isPending(); }
+    /**
+     * @brief Runs whole iterations of the loop found by `atFusibleLoop` 
+     * which fit in `maxCycles` calls to `cycle`. Returns the number of calls
+     * accounted for, the rest of the hardware must be advanced by as much.
+     */
+    cycles runFusedLoop(cycles maxCycles){
+        cycles fusedCycles = loopFusion.run(this, maxCycles);
+        clock += fusedCycles;
+        return fusedCycles;
+    }
+    /**
+     * @brief Enables or disables copy and fill loop fusion, see `LoopFusion`.
+     */
+    void setLoopFusionEnabled(bool state){ loopFusion.clear(); loopFusionEnabled = state; }
 
     /**
      * @brief Set's the CPU's double read bug flag to simulate a hardware issue.
@@ -137,16 +313,24 @@ public:
      */
     byte readNextInstructionByte();
 
+    /**
+     * @brief Returns the opcode pointed to by the PC without modifying
+     * any CPU state.
+     * 
+     * @return byte 
+     */
+    byte peekNextOpcode();
+
     /**
      * @brief Increment the program counter by one.
      */
-    void incPC() {PC++;}
+    void incPC() {regs.PC++;}
     /**
      * @brief Returns the current value of the program counter.
      * 
      * @returns word - The current value of the PC register.
      */
-    word getPC(){ return PC.read(); }
+    word getPC(){ return regs.PC; }
 
     /**
      * @brief Binds a memory module to the CPU. All future CPU operations are
@@ -155,6 +339,11 @@ public:
      * @param mem 
      */
     void bindMemory(Memory* mem) { memory = mem; }
+    /**
+     * @brief Binds the scheduler and APU which `runThreaded` runs alongside
+     * the instructions. Either may be nullptr if there is none.
+     */
+    void bindHardware(Scheduler* d_scheduler, APU* d_apu) { scheduler = d_scheduler; apu = d_apu; }
 
     /**
      * @brief Attempt to run the CPU. This will increase the CPU's internal 
@@ -177,6 +366,102 @@ public:
      */
     cycles fetchAndExecute();
 
+    /**
+     * @brief Runs instructions back to back using threaded dispatch: every
+     * handler is followed by its own copy of the code which fetches the next
+     * instruction and jumps straight to that one's handler. Each instruction
+     * runs on the same cycle `cycle` would run it on, with the bound 
+     * scheduler and APU run up to that cycle first.
+     * 
+     * Only instructions due within `maxCycles` calls to `cycle` are run. The
+     * run also stops after anything that may change when the hardware's next
+     * event is due (an I/O access, EI, DI, HALT, STOP), and after an idle or
+     * fusible loop is found. Returns the number of calls to `cycle` 
+     * accounted for, 0 if the next instruction has to go through `cycle`.
+     * 
+     * @param maxCycles - The cycles until the next hardware event.
+     * @return cycles 
+     */
+    cycles runThreaded(cycles maxCycles);
+
+    /**
+     * @brief Enables or disables the basic-block decode cache. While disabled
+     * every instruction is decoded directly from memory.
+     */
+    void setDecodeCacheEnabled(bool state){decodeCacheEnabled = state;}
+    /**
+     * @brief Drops all pre-decoded instructions. Called when the contents
+     * of ROM change.
+     */
+    void clearDecodeCache(){decodeCache.clear(); jit.clear(); loopFusion.clear();}
+
+    /**
+     * @brief Enables or disables the recompiler. While enabled, hot ROM 
+     * basic blocks run as compiled code, see `JIT`. Only has an effect on
+     * x86-64 builds.
+     */
+    void setJITEnabled(bool state){jitEnabled = state;}
+    bool isJITEnabled(){return jitEnabled;}
+
+    /**
+     * @brief Starts logging the basic blocks executed from ROM into `log`.
+     * Pass nullptr to stop logging.
+     */
+    void setBlockStartLog(std::set<uint32_t>* log){blockStartLog = log;}
+
+    /**
+     * @brief Enables or disables idle loop skipping, see `IdleLoopDetector`.
+     */
+    void setIdleLoopSkipEnabled(bool state){ idleLoop.stop(); idleLoopSkipEnabled = state; }
+    /**
+     * @brief Returns the number of cycles spent in idle loops which were
+     * replayed instead of interpreted.
+     */
+    uint64_t getIdleCyclesSkipped(){ return idleLoop.getSkippedCycles(); }
+
+#ifdef CPU_PROFILER
+    /**
+     * @brief Starts counting every instruction run into `profiler`. Pass
+     * nullptr to stop. While profiling, compiled blocks, idle loops and
+     * fused loops are interpreted so that no instruction goes uncounted.
+     */
+    void setProfiler(Profiler* d_profiler){ idleLoop.stop(); loopFusion.clear(); profiler = d_profiler; }
+#endif
+
+    /**
+     * @brief Starts tracing every instruction run into `recorder`. Pass
+     * nullptr to stop. Like the profiler, this disables the shortcuts which
+     * skip over instructions.
+     */
+    void setTraceRecorder(TraceRecorder* recorder){ idleLoop.stop(); loopFusion.clear(); traceRecorder = recorder; }
+
+    /**
+     * @brief Brings F up to date with the last ALU operation. Must be called
+     * before F is read or partially written.
+     */
+    void materializeFlags(){ if(lazyFlags.operation != LAZY_FLAGS_NONE) computeFlags(); }
+
+    /**
+     * @brief Enables or disables lazy flag evaluation. While disabled every
+     * ALU operation updates F straight away.
+     */
+    void setLazyFlagsEnabled(bool state){ materializeFlags(); lazyFlagsEnabled = state; }
+
+    /**
+     * @brief Selects the engine used to dispatch instructions. `Core` runs 
+     * through `runThreaded` in DISPATCH_THREADED mode, single instructions
+     * are always dispatched through the handler table.
+     * 
+     * @param mode - The dispatch mode to use for all future instructions.
+     */
+    void setDispatchMode(CPUDispatchModes mode) { dispatchMode = mode; }
+    /**
+     * @brief Returns the engine currently used to dispatch instructions.
+     * 
+     * @return CPUDispatchModes 
+     */
+    CPUDispatchModes getDispatchMode() { return dispatchMode; }
+
     /**
      * @brief Returns the current clock speed the CPU is running at.
      * 
@@ -184,6 +469,12 @@ public:
      */
     cycles getClockSpeed() { return doubleSpeedMode ? CLOCKSPEED_CGBMODE : CLOCKSPEED; }
 
+    /**
+     * @brief Returns the number of hardware cycles run since the CPU was reset.
+     * @return uint64_t 
+     */
+    uint64_t getClock() { return clock; }
+
     /**
      * @brief Returns the whether the CPU is running at double speed.
      * @return bool 
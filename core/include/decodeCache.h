@@ -0,0 +1,72 @@
+#ifndef DECODECACHE_H
+#define DECODECACHE_H
+/**
+ * DecodeCache class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include <vector>
+
+class Memory;
+
+// A single pre-decoded instruction.
+struct DecodedInstruction{
+    byte opcode;
+    // The length of the instruction in bytes. 0 marks an empty entry.
+    byte length;
+    word parsedData;
+};
+
+/**
+ * @brief A cache of pre-decoded basic blocks keyed by (ROM bank, PC).
+ *
+ * On a miss the whole basic block starting at the requested PC is decoded,
+ * stopping after the first instruction which can redirect control flow.
+ * Every instruction in the block is stored at its own (bank, offset) entry so
+ * jumps into the middle of a block also hit. Only the ROM regions are cached,
+ * ROM contents never change while a cartridge is loaded so entries stay valid
+ * for as long as the bank they belong to is mapped. Code executing from RAM
+ * is never cached and is always decoded directly from memory.
+ */
+class DecodeCache{
+private:
+    // One lazily allocated table of ROM_BANK_SIZE entries per ROM bank.
+    std::vector<DecodedInstruction*> banks;
+
+    /**
+     * @brief Decodes the basic block starting at `address` into `bankTable`.
+     */
+    void decodeBlock(Memory* memory, DecodedInstruction* bankTable, word address);
+
+public:
+    ~DecodeCache();
+
+    /**
+     * @brief Returns true if `address` is in a region the cache handles.
+     */
+    static bool isCacheable(word address) { return address <= ROMBANKN_END; }
+
+    /**
+     * @brief Returns true if the instruction ends a basic block by (possibly)
+     * redirecting control flow or stopping the CPU.
+     */
+    static bool endsBasicBlock(byte opcode);
+
+    /**
+     * @brief Returns the decoded instruction at `address`, decoding its basic
+     * block on a miss. Returns nullptr if the instruction cannot be cached
+     * (it is not in ROM or its operands cross into another region).
+     *
+     * @param memory - The memory the instruction is read from on a miss.
+     * @param address - The address of the instruction.
+     * @return const DecodedInstruction*
+     */
+    const DecodedInstruction* lookup(Memory* memory, word address);
+
+    /**
+     * @brief Drops every cached block. Must be called whenever the contents
+     * of ROM change, ie when a new cartridge is loaded.
+     */
+    void clear();
+};
+
+#endif
@@ -45,17 +45,18 @@ void convertWordToHexNotation(word value, char* output);
 void convertWordToBinaryNotation(word value, char *output);
 
 
-// Use to store the current state of the CPU.
+// Use to store the current state of the CPU. The CPU keeps its register 
+// file in this layout: each 16 bit pair overlaps its two 8 bit halves, 
+// low byte first, so both views are plain members. Assumes a little endian host.
 struct CPU_State{
 	// Main GBC registers.
-    word reg_AF;
-    word reg_BC;
-    word reg_DE;
-    word reg_HL;
-	// Stack pointer and program counter registers.
-	word SP;
+	union { word reg_AF; struct { byte F; byte A; }; };
+	union { word reg_BC; struct { byte C; byte B; }; };
+	union { word reg_DE; struct { byte E; byte D; }; };
+	union { word reg_HL; struct { byte L; byte H; }; };
+	// Program counter and stack pointer registers.
 	word PC;
-
+	word SP;
 };
 
 enum LoadCartridgeReturnCodes {
@@ -75,6 +76,46 @@ enum ExecutionModes {
 	STEP_CPU // Fetch and execute at keypress for a single instuction.
 };
 
+// CPU instruction dispatch engines.
+enum CPUDispatchModes {
+	DISPATCH_TABLE, // Indirect call through the opcode handler table.
+	DISPATCH_THREADED // Threaded dispatch (labels-as-values, switch fallback).
+};
+
+// The hardware events the core's scheduler keeps track of.
+enum SchedulerEvents {
+	EVENT_CPU, // The CPU's next instruction, or interrupt dispatch, is due.
+	EVENT_PPU, // A PPU mode change or STAT interrupt.
+	EVENT_TIMERS, // A DIV-APU tick, TIMA overflow or OAM DMA step.
+	EVENT_INTERRUPT, // A pending interrupt the CPU will wake up for or dispatch.
+	EVENT_FRAME_END, // The end of the frame being run.
+	SCHEDULER_EVENT_COUNT
+};
+
+// Where the MBC3 real time clock gets the time from.
+enum RTCTimeSources {
+	RTC_HOST_CLOCK, // The host's wall clock, the clock keeps running while the emulator is closed.
+	RTC_EMULATED_CLOCK, // Emulated CPU cycles, the same inputs always give the same clock.
+	RTC_FIXED_TIME // A set time which never advances.
+};
+
+// Threaded dispatch uses the GCC/Clang labels-as-values extension when 
+// available, otherwise it falls back to a dense switch.
+#if defined(__GNUC__) && !defined(CPU_NO_COMPUTED_GOTO)
+#define CPU_COMPUTED_GOTO
+#endif
+
+// Builds the CPU with the execution profiler hooks, see `Profiler`. Define
+// CPU_NO_PROFILER to leave them out of the interpreter entirely.
+#ifndef CPU_NO_PROFILER
+#define CPU_PROFILER
+#endif
+
+// The dispatch engine a freshly constructed CPU starts with.
+#ifndef CPU_DEFAULT_DISPATCH_MODE
+#define CPU_DEFAULT_DISPATCH_MODE DISPATCH_TABLE
+#endif
+
 // Used for memory controller functionality;
 
 // Callback function types.
@@ -83,7 +124,10 @@ typedef std::function<void(word, byte)> memoryControllerWriteFunctionTemplate;
 typedef std::function<byte(word)> memoryControllerReadFunctionTemplate;
 typedef std::function<void(std::ofstream &)> memoryControllerSaveToStateFunctionTemplate;
 typedef std::function<void(std::ifstream &)> memoryControllerLoadFromStateFunctionTemplate;
+typedef std::function<word(word)> memoryControllerROMBankFunctionTemplate;
 typedef std::function<void()> voidFuncWithNoArguments;
+// Returns the current time, in seconds, for the real time clock.
+typedef std::function<long long()> rtcTimeSourceFunctionTemplate;
 
 // CPU flags.
 #define FLAG_Z 7
@@ -91,6 +135,17 @@ typedef std::function<void()> voidFuncWithNoArguments;
 #define FLAG_H 5
 #define FLAG_C 4
 
+// The last ALU operation whose flags have not been written to F yet.
+enum LazyFlagOperations {
+	LAZY_FLAGS_NONE, // F is up to date.
+	LAZY_FLAGS_ADD,
+	LAZY_FLAGS_SUB, // Also used by CP.
+	LAZY_FLAGS_AND,
+	LAZY_FLAGS_OR, // Also used by XOR.
+	LAZY_FLAGS_INC,
+	LAZY_FLAGS_DEC
+};
+
 // Size of the memory address space.
 // GBC has a 16bit address bus -> 65,536 positions of memory
 #define MEM_SIZE 65536
@@ -219,6 +274,8 @@ const int LCD_CYCLES_PER_FRAME = CYCLES_PER_SCANLINE * NUM_SCANLINES;
 
 #define ROM_VERSION_NUMBER_ADDR 0x14C
 
+#define GLOBAL_CHECKSUM_START 0x14E
+
 // Memory controller types.
 #define ROM_ONLY 0x00     
 #define MBC1 0x01
@@ -404,7 +461,7 @@ const int AMOUNT_BG_TO_UPDATE_PER_CYCLE = (BGM0_DATA_END - BGM0_DATA_START + 1)
 
 #define LD_A_mDE 0x1A
 #define LD_A_mDE_CYCLES 1
-#define LD_A_mDE_LENGTH 8
+#define LD_A_mDE_LENGTH 1
 
 #define DEC_DE 0x1B
 #define DEC_DE_CYCLES 8
@@ -1121,7 +1178,7 @@ const int AMOUNT_BG_TO_UPDATE_PER_CYCLE = (BGM0_DATA_END - BGM0_DATA_START + 1)
 
 #define PREFIX_CB 0xCB
 #define PREFIX_CB_CYCLES 16
-#define PREFIX_CB_LENGTH 1
+#define PREFIX_CB_LENGTH 2
 
 #define CALL_Z_a16 0xCC
 #define CALL_Z_a16_CYCLES_MAX 24
@@ -1356,5 +1413,8 @@ const int AMOUNT_BG_TO_UPDATE_PER_CYCLE = (BGM0_DATA_END - BGM0_DATA_START + 1)
 
 const char SAVE_SUB_DIR[] = "saveStates";
 const char BAT_SAVE_SUB_DIR[] = "batterySaves";
+const char AOT_SUB_DIR[] = "aot";
+const char PROFILE_SUB_DIR[] = "profiles";
+const char TRACE_SUB_DIR[] = "traces";
 
 #endif
\ No newline at end of file
@@ -38,6 +38,11 @@ public:
      */
     void cycle(bool cpuDoubleSpeed);
 
+    /**
+     * @brief Returns true while an OAM DMA transfer is pending.
+     */
+    bool isTransferActive(){ return transferActive; }
+
     /**
      * @brief Reset the DMA Controller to its starting state.
      */
@@ -70,6 +75,18 @@ private:
 
     Memory* memory = nullptr;
 
+    /**
+     * @brief Copies `length` bytes from the source to VRAM with a single copy
+     * and marks the tiles written dirty. Returns false, having copied nothing,
+     * if the source is not plain memory or the copy would leave VRAM.
+     */
+    bool copyDirect(word length);
+    /**
+     * @brief Moves the addresses past `chunks` transferred chunks, ending
+     * the transfer after the last one.
+     */
+    void finishChunks(int chunks);
+
 public:
     /**
      * @brief Binds a memory module to the DMA Controller.
@@ -109,6 +126,11 @@ public:
      * if transferActive is false.
      */
     void transferChunk();
+    /**
+     * @brief Performs `chunks` chunks of transfer work at once. Does nothing
+     * if transferActive is false.
+     */
+    void transferChunks(int chunks);
 
     /**
      * @brief Reset the HDMA Controller to its starting state.
@@ -0,0 +1,142 @@
+#ifndef IDLELOOP_H
+#define IDLELOOP_H
+/**
+ * IdleLoopDetector class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include <vector>
+
+// Longest loop body, in instructions, considered for skipping.
+#define IDLE_LOOP_MAX_INSTRUCTIONS 8
+// Number of iterations recorded for a loop head before giving up on it.
+#define IDLE_LOOP_MAX_ATTEMPTS 8
+
+class CPU;
+
+// One instruction of a recorded idle loop.
+struct IdleLoopStep{
+    // The cycle count the CPU must bank before the instruction runs.
+    cycles cycleCount;
+    // The memory location read by the instruction, if any, and its value.
+    bool reads;
+    word readAddress;
+    byte readValue;
+    // The registers (with F up to date) once the instruction has run.
+    CPU_State stateAfter;
+};
+
+/**
+ * @brief Recognizes loops which spin without side effects, ie wait for an
+ * I/O register or a variable set by an interrupt handler to change.
+ *
+ * A loop is a candidate once a JR or JP jumps backwards over a short body
+ * made only of register operations and memory reads (see
+ * `isSideEffectFree`). The next iteration is then recorded instruction by
+ * instruction. If it ends with the exact register state it started from,
+ * every further iteration must repeat it for as long as the same memory
+ * locations return the same values.
+ *
+ * From then on the CPU replays the recorded steps in place of interpreting
+ * them: each step still waits for its cycles, reads its memory location and
+ * loads the recorded registers, so PC, the registers and timing are exact
+ * at every instruction boundary. Skipping stops as soon as a read returns
+ * a different value or an interrupt is dispatched, the interpreter then
+ * runs the instruction itself.
+ */
+class IdleLoopDetector{
+private:
+    enum IdleLoopStates {IDLE_LOOP_WATCHING, IDLE_LOOP_RECORDING, IDLE_LOOP_SKIPPING};
+    IdleLoopStates state = IDLE_LOOP_WATCHING;
+
+    // The address of the first instruction and of the backward branch.
+    word head = 0;
+    word branch = 0;
+    // The registers at the head when the current recording started.
+    CPU_State headState = {};
+    int attempts = 0;
+    // The last loop head which turned out not to be idle.
+    word rejectedHead = 0;
+    bool hasRejectedHead = false;
+
+    std::vector<IdleLoopStep> steps;
+    // The next step to replay.
+    size_t nextStep = 0;
+
+    // The total number of cycles replayed instead of interpreted.
+    uint64_t skippedCycles = 0;
+
+    /**
+     * @brief Returns the memory location read by an instruction, using the
+     * registers after it ran.
+     */
+    static bool readAddress(CPU* cpu, byte opcode, word parsedData, word& address);
+
+    /**
+     * @brief Gives up on the current loop head.
+     */
+    void reject();
+
+public:
+    IdleLoopDetector(){ steps.reserve(IDLE_LOOP_MAX_INSTRUCTIONS); }
+
+    /**
+     * @brief Returns true if an instruction may be part of an idle loop: it
+     * only reads memory, only writes the CPU's registers and cannot leave
+     * the loop other than through a branch.
+     */
+    static bool isSideEffectFree(byte opcode, word parsedData);
+
+    /**
+     * @brief Updates the detector after the interpreter ran an instruction.
+     *
+     * @param cpu - The CPU which ran the instruction.
+     * @param pc - The address of the instruction.
+     * @param opcode - The opcode of the instruction.
+     * @param parsedData - The immediate data of the instruction.
+     */
+    void afterInstruction(CPU* cpu, word pc, byte opcode, word parsedData);
+
+    /**
+     * @brief Returns true while a confirmed idle loop is being replayed.
+     */
+    bool isSkipping(){ return state == IDLE_LOOP_SKIPPING; }
+
+    /**
+     * @brief Returns the cycle count of the next step to replay.
+     */
+    cycles nextStepCycles(){ return steps[nextStep].cycleCount; }
+
+    /**
+     * @brief Replays the next step of the loop into the CPU's registers.
+     * Returns false, leaving the CPU untouched, if the value the step reads
+     * has changed. Skipping is then stopped.
+     */
+    bool replayStep(CPU* cpu);
+
+    /**
+     * @brief Returns true if every value the loop reads is still the recorded
+     * one and only changes on a hardware event (ie not DIV, TIMA or the sound
+     * registers). The loop then keeps spinning until the next event.
+     */
+    bool isSteady(CPU* cpu);
+
+    /**
+     * @brief Replays as many steps as fit in `numCycles` calls to
+     * `CPU::cycle`, without reading memory. Only valid while `isSteady`.
+     */
+    void advance(CPU* cpu, cycles numCycles);
+
+    /**
+     * @brief Stops skipping or recording. Must be called whenever the CPU's
+     * state changes outside of the interpreter.
+     */
+    void stop(){ state = IDLE_LOOP_WATCHING; }
+
+    /**
+     * @brief Returns the total number of cycles replayed instead of
+     * interpreted.
+     */
+    uint64_t getSkippedCycles(){ return skippedCycles; }
+};
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef INSTRUCTIONHARNESS_H
+#define INSTRUCTIONHARNESS_H
+/**
+ * InstructionHarness class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include "cpu.h"
+#include "memory.h"
+#include "memoryArena.h"
+#include <vector>
+#include <string>
+
+// The times each file's vectors are run when timing them.
+#define HARNESS_BENCHMARK_ITERATIONS 200
+// Every vector is checked and timed under each of these.
+#define HARNESS_DISPATCH_MODES {DISPATCH_TABLE, DISPATCH_THREADED}
+
+// The CPU and memory before or after a single step test.
+struct InstructionTestState{
+    CPU_State regs;
+    bool ime;
+    // (address, value) pairs of the memory the test touches.
+    std::vector<std::pair<word, byte>> ram;
+};
+
+// One single step test vector.
+struct InstructionTest{
+    std::string name;
+    InstructionTestState initial;
+    InstructionTestState expected;
+    // The T-cycles the instruction takes.
+    cycles cycleCount;
+};
+
+/**
+ * @brief Runs single step test vectors through the CPU's instruction
+ * handlers and times them.
+ *
+ * The vectors are the per opcode JSON files of the SingleStepTests (sm83)
+ * suite: each test gives the registers and memory before an instruction,
+ * the expected state after it and the memory accesses made on every
+ * M-cycle. Every test runs on a CPU whose memory is a flat 64KB buffer (see
+ * `Memory::setFlatBus`), so nothing but the instruction itself is involved.
+ *
+ * Every vector is run under each dispatch mode, through the handler table
+ * and through `CPU::runThreaded`, and only passes if it does under both.
+ * Once checked, every file's vectors are also run in a tight loop and the
+ * time per instruction is reported for each mode, so changes to the 
+ * handlers, dispatch or flags can be verified and measured in the same run.
+ */
+class InstructionHarness{
+private:
+    MemoryArena arena;
+    CPU cpu;
+    Memory memory;
+    byte* bus = nullptr;
+
+    /**
+     * @brief Parses a test file. Returns false if it cannot be read.
+     */
+    static bool loadTests(const std::string& filePath, std::vector<InstructionTest>& tests);
+
+    /**
+     * @brief Loads the initial state of a test into the CPU and the bus.
+     */
+    void setUp(const InstructionTest& test);
+    /**
+     * @brief Clears the memory a test touched.
+     */
+    void tearDown(const InstructionTest& test);
+
+    /**
+     * @brief Runs the instruction of a test, which has been set up, under 
+     * the CPU's dispatch mode. Returns the cycles it reports.
+     */
+    cycles execute(const InstructionTest& test);
+    /**
+     * @brief Runs a test. Returns false and describes the difference in
+     * `failure` if the result is not the expected one.
+     */
+    bool runTest(const InstructionTest& test, std::string& failure);
+
+    /**
+     * @brief Returns the average time, in nanoseconds, one of `tests`
+     * takes to execute.
+     */
+    double benchmark(const std::vector<InstructionTest>& tests);
+
+public:
+    InstructionHarness();
+    ~InstructionHarness();
+
+    /**
+     * @brief Checks and times every test file in `filePaths`, reporting on
+     * each to `output`. Returns 0 if every test passed, 1 otherwise.
+     */
+    int run(const std::vector<std::string>& filePaths, std::ostream& output);
+};
+
+#endif
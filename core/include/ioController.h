@@ -32,7 +32,13 @@ private:
     HDMAController hdmaController;
 
     // Timers.
-    Timer DIVTimer;
+    Scheduler* scheduler = nullptr;
+    // The 16-bit system counter DIV is the upper byte of, counted up to
+    // master cycle `systemCounterUpdatedAt`.
+    word systemCounter = 0;
+    uint64_t systemCounterUpdatedAt = 0;
+    // The CPU speed the timers are counting at.
+    bool timersDoubleSpeed = false;
     Timer TIMATimer;
     byte TMA = 0xFF;
     byte TAC = 0xFF;
@@ -54,10 +60,28 @@ public:
     */
     Joypad* getJoypad(){return &joypad;}
 
-    void init(CPU* d_cpu, PPU* d_ppu, APU* d_apu);
+    void init(CPU* d_cpu, PPU* d_ppu, APU* d_apu, Scheduler* d_scheduler);
     void bindMemory(Memory* d_memory);
     void reset();
     void cycle(bool cpuDoubleSpeed);
+
+    /**
+     * @brief Returns how many cycles can pass before the one where the timers
+     * raise an interrupt or a "DIV-APU" event, or the OAM DMA steps. Only
+     * those cycles need a call to `cycle`, the timers count the rest by
+     * themselves.
+     */
+    cycles cyclesUntilEvent(bool cpuDoubleSpeed);
+    /**
+     * @brief Returns the system counter as of master cycle `now`.
+     */
+    word getSystemCounter(uint64_t now){
+        return systemCounter + (word)((now - systemCounterUpdatedAt) * (timersDoubleSpeed ? 2 : 1));
+    }
+    /**
+     * @brief Changes the speed the timers count at from master cycle `now`.
+     */
+    void setTimersDoubleSpeed(uint64_t now, bool state);
   
     void TIMATimerOverflowLogic();
     byte read(word address);
@@ -0,0 +1,176 @@
+#ifndef JIT_H
+#define JIT_H
+/**
+ * JIT class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include "decodeCache.h"
+#include <vector>
+
+// The recompiler only has an x86-64 backend. Define JIT_DISABLED to build
+// without it, every lookup then misses and the interpreter runs everything.
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(JIT_DISABLED)
+#define JIT_SUPPORTED
+#endif
+
+// Number of times a block start must be reached by the interpreter before
+// it is compiled.
+#define JIT_HOT_THRESHOLD 32
+// Longest block compiled. Blocks only run once their total cycle cost has
+// been banked so this bounds how far a block can drift from the hardware.
+#define JIT_MAX_BLOCK_INSTRUCTIONS 32
+// Size of the executable arena holding compiled blocks. The arena is flushed
+// once full.
+#define JIT_ARENA_SIZE (16*1024*1024)
+
+class CPU;
+class Memory;
+
+// Blocks are passed the CPU they run on. Blocks emitted by the JIT have their
+// CPU built in and ignore it.
+typedef void (*compiledBlock)(CPU*);
+
+// How an instruction accesses memory through BC, DE or HL, see
+// `JIT::getRegisterAccess`.
+enum JITRegisterAccesses {
+    JIT_ACCESS_NONE = 0,
+    JIT_ACCESS_READ = 1,
+    JIT_ACCESS_WRITE = 2,
+    JIT_ACCESS_READ_WRITE = JIT_ACCESS_READ | JIT_ACCESS_WRITE
+};
+
+// A compiled basic block, or the execution count of a block not yet compiled.
+struct JITBlock{
+    compiledBlock code;
+    // The sum of the cycle counts of every instruction in the block.
+    cycles cycleCount;
+    uint16_t hits;
+    // Set if the block starts with an instruction which cannot be compiled.
+    bool rejected;
+};
+
+/**
+ * @brief A dynamic recompiler turning hot ROM basic blocks into x86-64.
+ *
+ * Blocks are keyed by (ROM bank, PC) like the decode cache they are built
+ * from. Register to register loads, 8 bit ALU operations on A, INC and DEC
+ * and jumps are emitted as x86 working on the CPU's registers directly, F
+ * included. Every other instruction becomes a direct call to its handler,
+ * preceded by stores of the PC and immediate data if the handler reads them,
+ * so all memory accesses still go through `Memory`. A block runs as a whole
+ * once the CPU has banked enough cycles for every instruction in it, handing
+ * the total cycle count back to the timing loop at the block exit.
+ *
+ * Only ROM is compiled so self modifying code always runs through the
+ * interpreter. Blocks stop before HALT, STOP, EI, DI, undefined opcodes and
+ * any instruction addressing the I/O registers directly. Blocks end after a
+ * store into 0000-7FFF as it may switch the ROM bank.
+ *
+ * Accesses through BC, DE or HL may reach anything, so they end the block
+ * and are guarded by a check of the page tables. If the page is not mapped
+ * to plain memory the block exits before the access, leaving its cycles
+ * banked, and the interpreter makes it on the cycle it would have anyway.
+ *
+ * The arena is writable only while a block is copied in and executable the
+ * rest of the time.
+ */
+class JIT{
+private:
+    // One lazily allocated table of ROM_BANK_SIZE blocks per ROM bank.
+    std::vector<JITBlock*> banks;
+
+    // Memory holding the compiled blocks.
+    byte* arena = nullptr;
+    size_t arenaUsed = 0;
+
+    // Set once blocks compiled elsewhere (see `AOT`) have been installed.
+    bool installedBlocks = false;
+
+    /**
+     * @brief Returns the block entry for (`bank`, `address`), allocating the
+     * bank table if necessary.
+     */
+    JITBlock& getEntry(word bank, word address);
+
+    /**
+     * @brief Drops every block compiled into the arena.
+     */
+    void flushArena();
+
+    /**
+     * @brief Compiles the basic block starting at `address` into `block`.
+     */
+    void compile(CPU* cpu, word address, JITBlock& block);
+
+    /**
+     * @brief Writes any flags a handler left pending to F, called by blocks
+     * before their own code reads or writes it.
+     */
+    static void materializeFlags(CPU* cpu);
+
+public:
+    ~JIT();
+
+    /**
+     * @brief Returns false for instructions which must always run through the
+     * interpreter, either because their timing relative to the rest of the
+     * hardware matters or because they cannot be executed inside a block.
+     */
+    static bool isCompilable(const DecodedInstruction& instruction);
+    /**
+     * @brief Returns true if a compiled block must end at `instruction`,
+     * either before it or right after it.
+     */
+    static bool endsBlock(const DecodedInstruction& instruction);
+    /**
+     * @brief Returns whether `instruction` reads and/or writes memory through
+     * BC, DE or HL, as `JITRegisterAccesses`. These accesses are compiled
+     * behind a check of the page tables.
+     */
+    static int getRegisterAccess(const DecodedInstruction& instruction);
+    /**
+     * @brief Returns true if the handler for `opcode` reads PC, ie every jump,
+     * call and return. The rest only need it set once the block ends.
+     */
+    static bool handlerReadsPC(byte opcode);
+
+    /**
+     * @brief Returns the compiled block starting at `address` or nullptr
+     * if there is none.
+     *
+     * @param memory - The memory used to resolve the mapped ROM bank.
+     * @param address - The PC of the block.
+     * @return const JITBlock*
+     */
+    const JITBlock* lookup(Memory* memory, word address);
+
+    /**
+     * @brief Records that the interpreter reached the start of a basic block
+     * at `address`, compiling it once it becomes hot.
+     *
+     * @param cpu - The CPU executing the block.
+     * @param address - The PC of the block.
+     */
+    void recordBlockStart(CPU* cpu, word address);
+
+    /**
+     * @brief Installs a block compiled ahead of time for (`bank`, `address`).
+     *
+     * @param bank - The ROM bank the block belongs to.
+     * @param address - The PC of the block.
+     * @param code - The compiled block.
+     * @param cycleCount - The total cycle count of the block.
+     */
+    void installBlock(word bank, word address, compiledBlock code, cycles cycleCount);
+    /**
+     * @brief Returns true if any ahead-of-time blocks are installed.
+     */
+    bool hasInstalledBlocks(){ return installedBlocks; }
+
+    /**
+     * @brief Drops every compiled and installed block.
+     */
+    void clear();
+};
+
+#endif
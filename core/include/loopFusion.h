@@ -0,0 +1,91 @@
+#ifndef LOOPFUSION_H
+#define LOOPFUSION_H
+/**
+ * LoopFusion class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+
+class CPU;
+
+// The copy and fill loops which can be run in bulk.
+enum FusedLoopKinds {
+    // LD A,(HL+) / LD (DE),A / INC DE / DEC BC / LD A,B / OR C / JR NZ
+    FUSED_LOOP_COPY_BC,
+    // LD A,(HL+) / LD (DE),A / INC DE / DEC r / JR NZ
+    FUSED_LOOP_COPY_8,
+    // LD (HL+),A or LD (HL-),A / DEC r / JR NZ
+    FUSED_LOOP_FILL_8
+};
+
+/**
+ * @brief Recognizes the canonical memcpy and memset loops and runs many of
+ * their iterations at once.
+ *
+ * The recognizer runs whenever a JR NZ jumps backwards in ROM and matches the
+ * code at the target against the known loops. The core then lets the CPU
+ * run as many whole iterations as fit before the next hardware event, see
+ * `Core::cyclesUntilNextEvent`. Nothing else can observe memory in that
+ * window so copying the bytes in one go is indistinguishable from running
+ * the loop. Registers, flags and the cycle count end up exactly where the
+ * interpreter would have left them after the same number of iterations,
+ * with the CPU back at the loop head. The last iteration, which exits the
+ * loop, is always left to the interpreter.
+ *
+ * Loops touching anything other than VRAM, WRAM, OAM and HRAM (ie I/O
+ * registers or cartridge RAM and bank switching registers) are never fused.
+ */
+class LoopFusion{
+private:
+    // Set when the CPU has just branched back to a recognized loop.
+    bool pending = false;
+    word head = 0;
+    FusedLoopKinds kind = FUSED_LOOP_COPY_BC;
+    // The DEC instruction counting down the COPY_8 and FILL_8 loops.
+    byte counterOpcode = DEC_C;
+    // 1 for LD (HL+),A, -1 for LD (HL-),A.
+    int fillDirection = 1;
+
+    // The last loop head matched, as (bank << 16) | pc, and whether it is
+    // one of the known loops.
+    uint32_t checkedKey = UINT32_MAX;
+    bool checkedMatch = false;
+
+    /**
+     * @brief Returns true if `length` bytes starting at `address` are all
+     * inside one of the plain RAM regions (or ROM if `allowROM` is set).
+     */
+    static bool isPlainMemory(word address, uint32_t length, bool allowROM);
+
+    /**
+     * @brief Returns the register decremented by `counterOpcode`.
+     */
+    byte& counter(CPU* cpu);
+
+public:
+    /**
+     * @brief Matches the code at `target` against the known loops. Called
+     * after a JR NZ jumped backwards to `target`.
+     */
+    void onBackwardBranch(CPU* cpu, word target);
+
+    /**
+     * @brief Returns true if the CPU has just branched back to a recognized
+     * loop.
+     */
+    bool isPending(){ return pending; }
+
+    /**
+     * @brief Runs whole iterations of the pending loop which fit in
+     * `maxCycles` calls to `CPU::cycle`. Returns the number of calls
+     * accounted for, 0 if nothing ran.
+     */
+    cycles run(CPU* cpu, cycles maxCycles);
+
+    /**
+     * @brief Forgets the last matched loop. Must be called when the contents
+     * of ROM change.
+     */
+    void clear(){ pending = false; checkedKey = UINT32_MAX; }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+/**
+ * MappedFile class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include <string>
+
+/**
+ * @brief A file mapped read-only into memory.
+ *
+ * Pages are only read in from disk as they are touched and are backed by
+ * the operating system's file cache, so every process with the same file
+ * mapped shares a single physical copy.
+ */
+class MappedFile{
+private:
+    const byte* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+
+public:
+    ~MappedFile(){ close(); }
+
+    /**
+     * @brief Maps the whole of `filePath`. Returns false if the file cannot
+     * be opened or mapped, callers are expected to fall back to reading it.
+     */
+    bool open(const std::string& filePath);
+
+    /**
+     * @brief Unmaps the file. Pointers into it are no longer valid.
+     */
+    void close();
+
+    bool isOpen(){ return data != nullptr; }
+    const byte* getData(){ return data; }
+    size_t getSize(){ return size; }
+};
+
+#endif
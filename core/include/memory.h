@@ -9,21 +9,38 @@ date: 2021-11-13
 #include <fstream>
 #include <set>
 
+// The memory map is looked up in pages of this many bytes.
+#define MEMORY_PAGE_SIZE 256
+#define MEMORY_PAGE_COUNT (MEM_SIZE / MEMORY_PAGE_SIZE)
+
 class Timer;
 class CPU;
 class IOController;
 class PPU;
 class Cartridge;
+class MemoryArena;
 
 class Memory{
 private:
     friend class PPU;
     friend class IOController;
+    // Compiled blocks check the page tables before accessing memory.
+    friend class JIT;
 
     memoryControllerWriteFunctionTemplate memoryControllerWrite = NULL;
     memoryControllerReadFunctionTemplate memoryControllerRead = NULL;
     memoryControllerSaveToStateFunctionTemplate memoryControllerSaveToState = NULL;
     memoryControllerLoadFromStateFunctionTemplate memoryControllerLoadFromState = NULL;
+    memoryControllerROMBankFunctionTemplate memoryControllerROMBank = NULL;
+
+    // The ROM bank currently mapped into 0000-3FFF and 4000-7FFF.
+    word mappedROMBanks[2] = {0, 1};
+
+    // The cartridge memory currently switched in, see `setCartridgeBanks`.
+    const byte* cartridgeROMBank0 = nullptr;
+    const byte* cartridgeROMBankN = nullptr;
+    byte* cartridgeRAMBank = nullptr;
+    word cartridgeRAMLength = 0;
 
     CPU* cpu = nullptr;
     IOController* ioController = nullptr;
@@ -45,17 +62,64 @@ private:
     byte* hRAM = nullptr;
 
     byte interruptEnableRegister;
+
+    // Reads and writes of the I/O ports and IE, see `getIOAccessCount`.
+    uint32_t ioAccesses = 0;
+
+    // If set, the whole address space is this 64KB buffer, see `setFlatBus`.
+    byte* flatBus = nullptr;
+
+    // The host memory behind each page of the memory map, or nullptr if
+    // accesses to the page have to go through `readSlowPath` or `writeSlowPath`.
+    const byte* readPageTable[MEMORY_PAGE_COUNT] = {};
+    byte* writePageTable[MEMORY_PAGE_COUNT] = {};
+
+    /**
+     * @brief Points the pages from `start` to `end` (inclusive) at `block`
+     * in `pageTable`. Pass nullptr to send them down the slow path.
+     */
+    void mapPages(byte** pageTable, word start, word end, byte* block);
+    void mapPages(const byte** pageTable, word start, word end, const byte* block);
+    /**
+     * @brief Rebuilds every page of the page tables.
+     */
+    void updatePageTable();
+    /**
+     * @brief Remaps 8000-9FFF to the selected VRAM bank.
+     */
+    void updateVRAMPages();
+    /**
+     * @brief Remaps D000-DFFF, and its echo, to the selected WRAM bank.
+     */
+    void updateWRAMPages();
+    /**
+     * @brief Remaps 0000-7FFF and A000-BFFF to the cartridge's current banks.
+     */
+    void updateCartridgePages();
+
+    /**
+     * @brief Handles the accesses the page tables do not map: writes to the
+     * memory controller, external RAM the controller has to see, VRAM tile
+     * data writes (which are tracked), OAM, I/O, HRAM and IE.
+     */
+    void writeSlowPath(word address, byte d_data);
+    const byte readSlowPath(word address);
 public:
     /**
-     * @brief Initializes the memory object. Dynamically allocates all blocks
-     * of memory. Returns a bool indicating success.
+     * @brief Initializes the memory object. Takes all blocks of memory
+     * from `arena`. Returns a bool indicating success.
      * 
      * @param d_cpu A pointer to the emulator's CPU.
      * @param d_ioController A pointer to the emulator's I/O controller.
      * @param d_ppu A pointer to the emulator's PPU.
      * @param d_cartridge A pointer to the emulator's cartridge.
+     * @param arena The arena to take memory from, with at least `arenaSize()` bytes free.
      */
-    bool init(CPU* d_cpu, IOController* d_ioController, PPU* d_ppu, Cartridge* d_cartridge);
+    bool init(CPU* d_cpu, IOController* d_ioController, PPU* d_ppu, Cartridge* d_cartridge, MemoryArena& arena);
+    /**
+     * @brief Returns the number of arena bytes `init` takes.
+     */
+    static size_t arenaSize();
 
     /**
      * @brief Sets all blocks of memory to their 
@@ -75,7 +139,7 @@ public:
     void initializeVRAM();
 
     /**
-     * @brief Deallocates all dynamic memory.
+     * @brief Drops all blocks of memory, the arena they came from frees them.
      */
     bool destroy();
 
@@ -86,13 +150,65 @@ public:
      * @param d_selectedVRAMBank The bank of VRAM to target.
      */
     void updateDirtyVRAM(word address, bool d_selectedVRAMBank); 
+    /**
+     * @brief Marks every tile overlapping `length` bytes of VRAM from `address` dirty.
+     *
+     * @param address The address of the first affected byte of VRAM.
+     * @param length The number of bytes written.
+     * @param d_selectedVRAMBank The bank of VRAM to target.
+     */
+    void updateDirtyVRAM(word address, word length, bool d_selectedVRAMBank);
     const std::set<int> & getDirtyTiles(){ return dirtyTiles; }
     void clearDirtyTiles(){ dirtyTiles.clear(); }
 
     // Accessors + Mutators -> the main data bus / memory map.
-    void write(word address, byte d_data);
-    const byte read(word address);
+    void write(word address, byte d_data){
+        byte* page = writePageTable[address >> 8];
+        if(page) page[address & 0xFF] = d_data;
+        else writeSlowPath(address, d_data);
+    }
+    const byte read(word address){
+        const byte* page = readPageTable[address >> 8];
+        if(page) return page[address & 0xFF];
+        return readSlowPath(address);
+    }
+    /**
+     * @brief Returns the number of reads and writes of the I/O ports and IE
+     * made so far. Any of them may change when the hardware's next event is
+     * due, or raise an interrupt.
+     */
+    uint32_t getIOAccessCount(){ return ioAccesses; }
     byte* getBytePointer(word address); 
+    /**
+     * @brief Returns the host memory behind `length` bytes from `address` if
+     * they can be read as one block, or nullptr if any of them has to be read
+     * through the slow path (I/O, OAM, memory controller registers) or they
+     * span more than one block of memory.
+     */
+    const byte* getReadBlock(word address, word length);
+
+    /**
+     * @brief Reads a little endian word, as operands and the stack are stored.
+     */
+    word read16(word address){
+        const byte* page = readPageTable[address >> 8];
+        if(page && (address & 0xFF) != 0xFF) return page[address & 0xFF] | (page[(address & 0xFF) + 1] << 8);
+        return read(address) | (read(address + 1) << 8);
+    }
+    /**
+     * @brief Writes a little endian word. The high byte is written first, the
+     * order a PUSH writes the stack in.
+     */
+    void write16(word address, word d_data){
+        byte* page = writePageTable[address >> 8];
+        if(page && (address & 0xFF) != 0xFF){
+            page[(address & 0xFF) + 1] = d_data >> 8;
+            page[address & 0xFF] = d_data & 0xFF;
+            return;
+        }
+        write(address + 1, d_data >> 8);
+        write(address, d_data & 0xFF);
+    }
 
     /**
      * @brief Sets the memory controller function. To be used when updating the
@@ -102,26 +218,55 @@ public:
      * @param readFunction The memory controller found on the cartridge which handles reads.
      * @param saveStateFunction Helper function to handle saving to states.
      * @param loadStateFunction Helper function to handle loading from states.
+     * @param romBankFunction Helper function returning the ROM bank mapped at an address.
     */
     void setMemoryController(
         memoryControllerWriteFunctionTemplate writeFunction, 
         memoryControllerReadFunctionTemplate readFunction,
         memoryControllerSaveToStateFunctionTemplate saveStateFunction,
-        memoryControllerLoadFromStateFunctionTemplate loadStateFunction
+        memoryControllerLoadFromStateFunctionTemplate loadStateFunction,
+        memoryControllerROMBankFunctionTemplate romBankFunction
+    );
 
-    ){
-        memoryControllerWrite = writeFunction;
-        memoryControllerRead = readFunction;
-        memoryControllerSaveToState = saveStateFunction;
-        memoryControllerLoadFromState = loadStateFunction;
-    }
+    /**
+     * @brief Maps the cartridge banks currently switched in straight into the
+     * page tables so accesses to them skip the memory controller. Called by the
+     * cartridge whenever its banking registers change.
+     *
+     * @param romBank0 The ROM bank at 0000-3FFF, or nullptr.
+     * @param romBankN The ROM bank at 4000-7FFF, or nullptr.
+     * @param ramBank The external RAM at A000, or nullptr if RAM is disabled
+     * or not plain memory (ie an RTC register is selected).
+     * @param ramLength The number of bytes of `ramBank` to map.
+    */
+    void setCartridgeBanks(const byte* romBank0, const byte* romBankN, byte* ramBank, word ramLength);
+
+    /**
+     * @brief Refreshes the cached ROM bank numbers from the memory controller.
+     * Called after anything which may remap the ROM regions.
+     */
+    void updateMappedROMBanks();
+    /**
+     * @brief Returns the ROM bank currently mapped at a ROM address (0000-7FFF).
+     */
+    word getMappedROMBank(word address){ return mappedROMBanks[address >> 14]; }
+
+    /**
+     * @brief Replaces the memory map with a flat 64KB buffer with no banking
+     * or I/O behind it, used to run instructions in isolation. Pass nullptr
+     * to restore the memory map.
+     *
+     * Every page of the page tables points into the buffer, so the slow
+     * path is never taken.
+     */
+    void setFlatBus(byte* bus);
 
     /**
      * @brief Updates the VRAM bank currently used.
      *
      * @param vramBank The bank to switch to.
     */
-    void setActiveVRAMBank(bool vramBank){selectedVRAMBank = vramBank;}
+    void setActiveVRAMBank(bool vramBank){selectedVRAMBank = vramBank; updateVRAMPages();}
     bool getActiveVRAMBank(){return selectedVRAMBank;}
     byte* getVRAMBank(bool vramBank){ return vramBank ? vRAMBank1 : vRAMBank2; }
 
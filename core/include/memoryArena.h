@@ -0,0 +1,69 @@
+#ifndef MEMORYARENA_H
+#define MEMORYARENA_H
+/**
+ * MemoryArena class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include <memory>
+
+// Every block in the arena starts on its own cache line.
+#define MEMORY_ARENA_ALIGNMENT 64
+
+/**
+ * @brief A single allocation holding all of the emulated hardware's memory.
+ *
+ * Blocks are handed out in the order they are asked for, so a core always
+ * lays its memory out the same way with the blocks next to each other.
+ * The whole of a core's state can then be copied with one `memcpy` of
+ * `getData()`, and `getSize()` is its footprint. Blocks are never freed
+ * individually, the arena releases them all at once.
+ */
+class MemoryArena{
+private:
+    byte* data = nullptr;
+    size_t size = 0;
+    size_t used = 0;
+
+public:
+    ~MemoryArena(){ destroy(); }
+
+    /**
+     * @brief Returns the space `count` objects of type T take up in an
+     * arena, padded to the arena's alignment.
+     */
+    template<typename T>
+    static size_t blockSize(size_t count){
+        return (sizeof(T) * count + MEMORY_ARENA_ALIGNMENT - 1) & ~(size_t)(MEMORY_ARENA_ALIGNMENT - 1);
+    }
+
+    /**
+     * @brief Allocates and zeroes `capacity` bytes. Returns false if the
+     * allocation failed.
+     */
+    bool init(size_t capacity);
+
+    /**
+     * @brief Frees the arena along with every block handed out from it.
+     */
+    void destroy();
+
+    /**
+     * @brief Returns the next `count` objects of type T in the arena, or
+     * nullptr if the arena does not have the space left.
+     */
+    template<typename T>
+    T* allocate(size_t count){
+        size_t bytes = blockSize<T>(count);
+        if(data == nullptr || used + bytes > size) return nullptr;
+        T* block = reinterpret_cast<T*>(data + used);
+        std::uninitialized_value_construct_n(block, count);
+        used += bytes;
+        return block;
+    }
+
+    byte* getData(){ return data; }
+    size_t getSize(){ return size; }
+    size_t getUsed(){ return used; }
+};
+
+#endif
@@ -9,6 +9,8 @@
 #include <list>
 
 class Memory;
+class MemoryArena;
+class Scheduler;
 
 class OAMEntry{
 public:
@@ -113,17 +115,31 @@ private:
     // Keeps track of the "cycle currency" the PPU can spend.
     cycles cyclesCounter = 0;
 
+    // The master clock, and the master cycle the PPU has run up to.
+    Scheduler* scheduler = nullptr;
+    uint64_t syncedAt = 0;
+
+    /**
+     * @brief Does the work of `numCycles` calls to `cycle`. Must not be used
+     * past `cyclesUntilEvent`.
+     */
+    void advance(cycles numCycles);
+
 public:
     byte getSCY(){return SCY;}
     byte getSCX(){return SCX;}
     /**
-     * @brief Dynamically allocates all blocks
-     * of memory. Returns a bool indicating success.
+     * @brief Takes all blocks of memory from `arena`. 
+     * Returns a bool indicating success.
      */
-    bool init();
+    bool init(MemoryArena& arena);
+    /**
+     * @brief Returns the number of arena bytes `init` takes.
+     */
+    static size_t arenaSize();
     
     /**
-     * @brief Deallocates all dynamic memory.
+     * @brief Drops all blocks of memory, the arena they came from frees them.
      */
     void destroy();
 
@@ -149,13 +165,36 @@ public:
      * @param mem 
      */
     void bindMemory(Memory* mem) { memory = mem; }
+    /**
+     * @brief Binds the scheduler whose master cycle count the PPU runs to.
+     */
+    void bindScheduler(Scheduler* d_scheduler) { scheduler = d_scheduler; }
 
     /**
-     * @brief Perform any work need on this clock cycle. This will increase 
-     * the PPU's internal cycle counter.
+     * @brief Perform any work need on the current master cycle, after
+     * catching up to it. This will increase the PPU's internal cycle counter.
      */
     void cycle();
 
+    /**
+     * @brief Runs the PPU up to the current master cycle. Between events the
+     * PPU only counts cycles, so it is left idle and caught up in one go
+     * before anything looks at it.
+     */
+    void catchUp();
+    /**
+     * @brief Catches up and makes the PPU's event due so it runs the current
+     * cycle. Called before a register the PPU reads is written, which may
+     * move its next event.
+     */
+    void registerWritten();
+
+    /**
+     * @brief Returns how many master cycles can pass before the PPU changes
+     * mode, scanline or any register and `cycle` has to be called.
+     */
+    cycles cyclesUntilEvent();
+
     /**
      * @brief Renders the current scanline of VRAM to the video buffer.
      */
@@ -0,0 +1,131 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+/**
+ * Profiler class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+#include <vector>
+#include <string>
+
+// The bank reported for code running outside of ROM.
+#define PROFILER_NO_BANK UINT32_MAX
+
+// Executions and cycles counted for an opcode.
+struct ProfileCounter{
+    uint64_t executions;
+    uint64_t cycles;
+};
+
+// Executions and cycles counted for one address, along with the instruction
+// last seen there.
+struct ProfileAddressCounter{
+    uint64_t executions;
+    uint64_t cycles;
+    byte opcode;
+    byte cbOpcode;
+};
+
+// One row of a profile report.
+struct ProfileHotSpot{
+    // The ROM bank and address, or PROFILER_NO_BANK and an address outside
+    // of ROM. Both are unset in the per opcode rows.
+    uint32_t bank;
+    word pc;
+    byte opcode;
+    byte cbOpcode;
+    uint64_t executions;
+    uint64_t cycles;
+};
+
+/**
+ * @brief Counts the executions and cycles of every instruction the CPU runs,
+ * per opcode (with the CB prefixed opcodes counted separately) and per
+ * (ROM bank, address).
+ *
+ * The CPU only calls into the profiler while one is attached, see
+ * `CPU::setProfiler`, and the hooks are compiled out entirely unless
+ * CPU_PROFILER is defined. The per address tables are allocated lazily,
+ * one per ROM bank executed from.
+ */
+class Profiler{
+private:
+    ProfileCounter opcodes[256] = {};
+    ProfileCounter cbOpcodes[256] = {};
+
+    // One lazily allocated table of ROM_BANK_SIZE entries per ROM bank and
+    // region it is mapped into, indexed by (bank << 1) | (pc >> 14).
+    std::vector<ProfileAddressCounter*> romBanks;
+    // Everything from VRAM up, ie code copied into RAM.
+    ProfileAddressCounter* ramTable = nullptr;
+
+    uint64_t totalCycles = 0;
+
+    /**
+     * @brief Returns the counter for an address, allocating its table on
+     * first use.
+     */
+    ProfileAddressCounter& addressCounter(uint32_t bank, word pc);
+
+    /**
+     * @brief Collects the counters into rows sorted by cycles, most first.
+     */
+    std::vector<ProfileHotSpot> opcodeRows(bool cb);
+    std::vector<ProfileHotSpot> addressRows(size_t count);
+
+public:
+    ~Profiler();
+
+    /**
+     * @brief Counts one executed instruction.
+     *
+     * @param bank - The ROM bank mapped at `pc`, or PROFILER_NO_BANK.
+     * @param pc - The address of the instruction.
+     * @param opcode - The opcode of the instruction.
+     * @param cbOpcode - The second byte of a CB prefixed instruction.
+     * @param cycleCount - The cycles the instruction took.
+     */
+    void record(uint32_t bank, word pc, byte opcode, byte cbOpcode, cycles cycleCount){
+        ProfileCounter& counter = opcode == PREFIX_CB ? cbOpcodes[cbOpcode] : opcodes[opcode];
+        counter.executions++;
+        counter.cycles += cycleCount;
+
+        ProfileAddressCounter& address = addressCounter(bank, pc);
+        address.executions++;
+        address.cycles += cycleCount;
+        address.opcode = opcode;
+        address.cbOpcode = cbOpcode;
+        totalCycles += cycleCount;
+    }
+
+    /**
+     * @brief Clears all counters.
+     */
+    void reset();
+
+    /**
+     * @brief Returns the total number of cycles counted.
+     */
+    uint64_t getTotalCycles(){ return totalCycles; }
+
+    /**
+     * @brief Returns the `count` addresses which took the most cycles, most
+     * first.
+     */
+    std::vector<ProfileHotSpot> getHotSpots(size_t count){ return addressRows(count); }
+
+    /**
+     * @brief Returns the mnemonic of an instruction, using `cbOpcode` for
+     * the CB prefixed ones (ie "BIT_7_H").
+     */
+    static std::string instructionName(byte opcode, byte cbOpcode);
+
+    /**
+     * @brief Writes the per opcode, per CB opcode and per address reports,
+     * each sorted by cycles, to `filePath`. The report is JSON if the file
+     * ends in ".json" and CSV otherwise. Returns false if the file could not
+     * be written.
+     */
+    bool writeReport(const std::string& filePath);
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+/**
+ * Scheduler class declaration for a GameBoy Color emulator.
+ */
+#include "defines.h"
+
+// The time of an event which is not pending.
+#define SCHEDULER_NEVER UINT64_MAX
+
+/**
+ * @brief Keeps the master cycle count and the time each of the hardware's
+ * events is next due.
+ *
+ * Between events nothing but internal counters change, so the core runs
+ * every component straight up to the earliest event in one call rather
+ * than cycling them a T-cycle at a time. There are only a handful of
+ * event sources, one slot each, so finding the earliest is a short scan.
+ */
+class Scheduler{
+private:
+    // T-cycles run since the scheduler was created.
+    uint64_t now = 0;
+    // When each event is next due, SCHEDULER_NEVER if it is not pending.
+    uint64_t eventTimes[SCHEDULER_EVENT_COUNT];
+
+public:
+    Scheduler(){ reset(); }
+
+    /**
+     * @brief Cancels every event. The master cycle count keeps running.
+     */
+    void reset();
+
+    /**
+     * @brief Schedules `event` `delay` cycles from now, replacing any time it
+     * was already due. A delay of UINT32_MAX, which components use to say
+     * they have nothing coming up, cancels it.
+     */
+    void schedule(SchedulerEvents event, cycles delay){
+        eventTimes[event] = delay == UINT32_MAX ? SCHEDULER_NEVER : now + delay;
+    }
+    void cancel(SchedulerEvents event){ eventTimes[event] = SCHEDULER_NEVER; }
+    /**
+     * @brief Returns true once `event` has come due.
+     */
+    bool isDue(SchedulerEvents event){ return now >= eventTimes[event]; }
+
+    /**
+     * @brief Returns the number of cycles until the earliest pending event,
+     * 0 if one is already due.
+     */
+    cycles cyclesUntilNextEvent();
+
+    /**
+     * @brief Moves the master cycle count on by `numCycles`.
+     */
+    void advance(cycles numCycles){ now += numCycles; }
+    uint64_t getNow(){ return now; }
+};
+
+#endif
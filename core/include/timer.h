@@ -6,24 +6,58 @@ The header declaration for the emulator's external timer.
 
 #include "defines.h"
 #include "sdlController.h"
+#include "scheduler.h"
 
+/**
+ * The timer is only brought up to date when it is read, written, or about
+ * to overflow. Everything in between is worked out in closed form from the
+ * master cycle count, see `Scheduler`.
+ */
 class Timer {
 private:
     byte data = 0xFF;
     cycles clockSpeed = 0;
     bool running = false;
+    bool doubleSpeed = false;
 
     cycles cyclesPassed = 0;
+    // The master cycle `data` and `cyclesPassed` are counted up to.
+    uint64_t updatedAt = 0;
+    // The master cycle the register overflows in, SCHEDULER_NEVER while stopped.
+    uint64_t overflowAt = SCHEDULER_NEVER;
+
+    /**
+     * @brief Works out `overflowAt` from the current state.
+     */
+    void scheduleOverflow();
 
 public:
+    /**
+     * @brief Counts every cycle before master cycle `now`, which must not be
+     * past the cycle the register overflows in.
+     */
+    void update(uint64_t now);
 
     // Accessor functions.
-    byte read() {return data;}
-    // Mutator functions.
-    void setIncrementFrequency(cycles frequency);
-    void setRunning(bool state);
-    void resetTimer(byte resetValue);
-    void cycle(bool cpuDoubleSpeed, voidFuncWithNoArguments overflowOperation = NULL);
+    byte read(uint64_t now) {update(now); return data;}
+    // Mutator functions. Each takes effect from master cycle `now`.
+    void setIncrementFrequency(uint64_t now, cycles frequency);
+    void setRunning(uint64_t now, bool state);
+    void setDoubleSpeed(uint64_t now, bool state);
+    void resetTimer(uint64_t now, byte resetValue);
+
+    /**
+     * @brief Runs master cycle `now` if the register overflows in it, the
+     * register is then reloaded with `reloadValue`. Returns true if it
+     * overflowed.
+     */
+    bool cycle(uint64_t now, byte reloadValue);
+
+    /**
+     * @brief Returns how many cycles from `now` pass before the one the
+     * register overflows in. UINT32_MAX if the timer is stopped.
+     */
+    cycles cyclesUntilOverflow(uint64_t now);
 
     /**
      * @brief Writes the current state to a state file.
@@ -35,8 +69,9 @@ public:
      * @brief Load the current state from a state file.
      *
      * @param readBuffer The buffer to read from.
+     * @param now The master cycle the state is loaded at.
     */
-    void loadFromState(byte*& readBuffer);
+    void loadFromState(byte*& readBuffer, uint64_t now);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,322 @@
+/**
+ * InstructionHarness class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\instructionHarness.h"
+#include "include\profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+
+// A parsed JSON value, only as much as the test files need.
+struct JsonValue{
+    enum {JSON_NULL, JSON_NUMBER, JSON_STRING, JSON_ARRAY, JSON_OBJECT} type = JSON_NULL;
+    double number = 0;
+    std::string string;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue* get(const char* key) const {
+        for(const auto& member : members) if(member.first == key) return &member.second;
+        return nullptr;
+    }
+    int asInt(const char* key) const {
+        const JsonValue* value = get(key);
+        return value ? (int)value->number : 0;
+    }
+};
+
+// A recursive descent parser over the whole file.
+class JsonParser{
+private:
+    const std::string& text;
+    size_t position = 0;
+
+    void skipWhitespace(){ while(position < text.size() && isspace((unsigned char)text[position])) position++; }
+    bool expect(char c){
+        skipWhitespace();
+        if(position >= text.size() || text[position] != c) return false;
+        position++;
+        return true;
+    }
+    bool parseString(std::string& out){
+        if(!expect('"')) return false;
+        while(position < text.size() && text[position] != '"'){
+            // Escapes never matter for the test files, keep the escaped character.
+            if(text[position] == '\\') position++;
+            out += text[position++];
+        }
+        return expect('"');
+    }
+
+public:
+    JsonParser(const std::string& d_text) : text(d_text) {}
+
+    bool parse(JsonValue& value){
+        skipWhitespace();
+        if(position >= text.size()) return false;
+        char c = text[position];
+        if(c == '{'){
+            value.type = JsonValue::JSON_OBJECT;
+            position++;
+            if(expect('}')) return true;
+            do {
+                std::pair<std::string, JsonValue> member;
+                if(!parseString(member.first) || !expect(':') || !parse(member.second)) return false;
+                value.members.push_back(std::move(member));
+            } while(expect(','));
+            return expect('}');
+        }
+        if(c == '['){
+            value.type = JsonValue::JSON_ARRAY;
+            position++;
+            if(expect(']')) return true;
+            do {
+                value.items.emplace_back();
+                if(!parse(value.items.back())) return false;
+            } while(expect(','));
+            return expect(']');
+        }
+        if(c == '"'){
+            value.type = JsonValue::JSON_STRING;
+            return parseString(value.string);
+        }
+        if(text.compare(position, 4, "null") == 0){
+            position += 4;
+            return true;
+        }
+        if(text.compare(position, 4, "true") == 0 || text.compare(position, 5, "false") == 0){
+            value.type = JsonValue::JSON_NUMBER;
+            value.number = text[position] == 't';
+            position += text[position] == 't' ? 4 : 5;
+            return true;
+        }
+        char* end = nullptr;
+        value.type = JsonValue::JSON_NUMBER;
+        value.number = strtod(text.c_str() + position, &end);
+        if(end == text.c_str() + position) return false;
+        position = end - text.c_str();
+        return true;
+    }
+};
+
+static InstructionTestState parseState(const JsonValue& state){
+    InstructionTestState parsed = {};
+    parsed.regs.A = state.asInt("a");
+    parsed.regs.F = state.asInt("f");
+    parsed.regs.B = state.asInt("b");
+    parsed.regs.C = state.asInt("c");
+    parsed.regs.D = state.asInt("d");
+    parsed.regs.E = state.asInt("e");
+    parsed.regs.H = state.asInt("h");
+    parsed.regs.L = state.asInt("l");
+    parsed.regs.PC = state.asInt("pc");
+    parsed.regs.SP = state.asInt("sp");
+    parsed.ime = state.asInt("ime") != 0;
+    const JsonValue* ram = state.get("ram");
+    if(ram){
+        for(const JsonValue& entry : ram->items){
+            if(entry.items.size() == 2) parsed.ram.push_back({(word)entry.items[0].number, (byte)entry.items[1].number});
+        }
+    }
+    return parsed;
+}
+
+static const char* dispatchModeName(CPUDispatchModes mode){
+    return mode == DISPATCH_THREADED ? "threaded" : "table";
+}
+
+InstructionHarness::InstructionHarness(){
+    bus = new byte[0x10000]();
+    arena.init(Memory::arenaSize());
+    memory.init(&cpu, nullptr, nullptr, nullptr, arena);
+    memory.setFlatBus(bus);
+    cpu.bindMemory(&memory);
+
+    // Only the instruction handlers themselves are under test.
+    cpu.setDecodeCacheEnabled(false);
+    cpu.setIdleLoopSkipEnabled(false);
+    cpu.setLoopFusionEnabled(false);
+}
+
+InstructionHarness::~InstructionHarness(){
+    memory.setFlatBus(nullptr);
+    memory.destroy();
+    delete[] bus;
+}
+
+bool InstructionHarness::loadTests(const std::string& filePath, std::vector<InstructionTest>& tests){
+    std::ifstream testFile(filePath);
+    if(!testFile.is_open()){
+        std::cout << "ERROR: Could not open the test file \"" << filePath << "\"!" << std::endl;
+        return false;
+    }
+    std::stringstream contents;
+    contents << testFile.rdbuf();
+    std::string text = contents.str();
+
+    JsonValue root;
+    if(!JsonParser(text).parse(root) || root.type != JsonValue::JSON_ARRAY){
+        std::cout << "ERROR: \"" << filePath << "\" is not a list of single step tests!" << std::endl;
+        return false;
+    }
+
+    for(const JsonValue& entry : root.items){
+        const JsonValue* initial = entry.get("initial");
+        const JsonValue* expected = entry.get("final");
+        const JsonValue* accesses = entry.get("cycles");
+        if(!initial || !expected || !accesses) continue;
+
+        InstructionTest test;
+        const JsonValue* name = entry.get("name");
+        test.name = name ? name->string : "";
+        test.initial = parseState(*initial);
+        test.expected = parseState(*expected);
+        // One entry per M-cycle.
+        test.cycleCount = (cycles)accesses->items.size() * 4;
+        tests.push_back(std::move(test));
+    }
+    return true;
+}
+
+void InstructionHarness::setUp(const InstructionTest& test){
+    cpu.regs = test.initial.regs;
+    cpu.lazyFlags.operation = LAZY_FLAGS_NONE;
+    cpu.masterInterruptEnableFlag = test.initial.ime;
+    cpu.lowPowerMode = false;
+    cpu.doubleReadBug = false;
+    cpu.doubleSpeedMode = false;
+    cpu.activeInterruptVector = 0x0000;
+    cpu.cyclesSinceLastInstuction = 0;
+    for(const auto& entry : test.initial.ram) bus[entry.first] = entry.second;
+}
+
+void InstructionHarness::tearDown(const InstructionTest& test){
+    for(const auto& entry : test.initial.ram) bus[entry.first] = 0;
+    for(const auto& entry : test.expected.ram) bus[entry.first] = 0;
+}
+
+cycles InstructionHarness::execute(const InstructionTest& test){
+    // Threaded dispatch is given exactly the cycles of one instruction.
+    if(cpu.getDispatchMode() == DISPATCH_THREADED) return cpu.runThreaded(INSTRUCTION_SET[bus[test.initial.regs.PC]].cycleCount);
+    return cpu.fetchAndExecute();
+}
+
+bool InstructionHarness::runTest(const InstructionTest& test, std::string& failure){
+    setUp(test);
+    // Threaded dispatch reports the calls to `cycle` it accounted for, which
+    // is always an instruction's longest time. The handler's own count is
+    // checked through the table.
+    cycles expectedCycles = test.cycleCount;
+    if(cpu.getDispatchMode() == DISPATCH_THREADED) expectedCycles = INSTRUCTION_SET[bus[test.initial.regs.PC]].cycleCount;
+    cycles executedCycles = execute(test);
+    cpu.materializeFlags();
+
+    std::ostringstream differences;
+    differences << std::hex << std::uppercase << std::setfill('0');
+    const CPU_State& expected = test.expected.regs;
+    auto compare = [&differences](const char* name, unsigned actual, unsigned wanted, int width){
+        if(actual == wanted) return;
+        differences << " " << name << "=" << std::setw(width) << actual << " (expected " << std::setw(width) << wanted << ")";
+    };
+    compare("AF", cpu.regs.reg_AF, expected.reg_AF, 4);
+    compare("BC", cpu.regs.reg_BC, expected.reg_BC, 4);
+    compare("DE", cpu.regs.reg_DE, expected.reg_DE, 4);
+    compare("HL", cpu.regs.reg_HL, expected.reg_HL, 4);
+    compare("PC", cpu.regs.PC, expected.PC, 4);
+    compare("SP", cpu.regs.SP, expected.SP, 4);
+    compare("IME", cpu.masterInterruptEnableFlag, test.expected.ime, 1);
+    for(const auto& entry : test.expected.ram){
+        if(bus[entry.first] == entry.second) continue;
+        differences << " [" << std::setw(4) << entry.first << "]=" << std::setw(2) << (unsigned)bus[entry.first]
+                    << " (expected " << std::setw(2) << (unsigned)entry.second << ")";
+    }
+    differences << std::dec;
+    if(executedCycles != expectedCycles) differences << " cycles=" << executedCycles << " (expected " << expectedCycles << ")";
+
+    tearDown(test);
+    failure = differences.str();
+    return failure.empty();
+}
+
+double InstructionHarness::benchmark(const std::vector<InstructionTest>& tests){
+    if(tests.empty()) return 0;
+    auto now = []{ return std::chrono::steady_clock::now(); };
+
+    // Time the set up alone and take it out of the total.
+    auto start = now();
+    for(int iteration = 0; iteration < HARNESS_BENCHMARK_ITERATIONS; iteration++){
+        for(const InstructionTest& test : tests){
+            setUp(test);
+            cpu.materializeFlags();
+        }
+    }
+    auto setUpTime = now() - start;
+
+    start = now();
+    for(int iteration = 0; iteration < HARNESS_BENCHMARK_ITERATIONS; iteration++){
+        for(const InstructionTest& test : tests){
+            setUp(test);
+            execute(test);
+            cpu.materializeFlags();
+        }
+    }
+    auto totalTime = now() - start;
+    for(const InstructionTest& test : tests) tearDown(test);
+
+    double executeTime = std::chrono::duration<double, std::nano>(totalTime - setUpTime).count();
+    return std::max(executeTime, 0.0) / ((double)tests.size() * HARNESS_BENCHMARK_ITERATIONS);
+}
+
+int InstructionHarness::run(const std::vector<std::string>& filePaths, std::ostream& output){
+    size_t totalTests = 0, totalPassed = 0;
+    for(const std::string& filePath : filePaths){
+        std::vector<InstructionTest> tests;
+        if(!loadTests(filePath, tests)) continue;
+
+        // A test only passes if it does under every dispatch mode.
+        size_t passed = 0;
+        std::string firstFailure;
+        for(const InstructionTest& test : tests){
+            bool testPassed = true;
+            for(CPUDispatchModes mode : HARNESS_DISPATCH_MODES){
+                cpu.setDispatchMode(mode);
+                std::string failure;
+                if(runTest(test, failure)) continue;
+                testPassed = false;
+                if(firstFailure.empty()) firstFailure = test.name + " (" + dispatchModeName(mode) + "):" + failure;
+            }
+            if(testPassed) passed++;
+        }
+
+        // Name the file by its opcode, ie "cb 7c".
+        std::string opcode = "?";
+        if(!tests.empty()){
+            byte first = 0;
+            for(const auto& entry : tests[0].initial.ram) if(entry.first == tests[0].initial.regs.PC) first = entry.second;
+            opcode = first == PREFIX_CB ? "prefixed" : Profiler::instructionName(first, 0);
+            if(first == PREFIX_CB){
+                for(const auto& entry : tests[0].initial.ram){
+                    if(entry.first == (word)(tests[0].initial.regs.PC + 1)) opcode = Profiler::instructionName(PREFIX_CB, entry.second);
+                }
+            }
+        }
+
+        output << std::left << std::setw(24) << filePath << " " << std::setw(12) << opcode << std::right
+               << std::setw(6) << passed << "/" << std::setw(6) << tests.size() << std::fixed << std::setprecision(2);
+        for(CPUDispatchModes mode : HARNESS_DISPATCH_MODES){
+            cpu.setDispatchMode(mode);
+            output << std::setw(10) << benchmark(tests) << " ns/instruction " << dispatchModeName(mode);
+        }
+        output << std::endl;
+        if(!firstFailure.empty()) output << "    first failure: " << firstFailure << std::endl;
+
+        totalTests += tests.size();
+        totalPassed += passed;
+    }
+
+    output << totalPassed << "/" << totalTests << " tests passed." << std::endl;
+    return totalPassed == totalTests ? 0 : 1;
+}
@@ -8,209 +8,182 @@ date: 2021-11-13
 #include <iostream>
 
 cycles Arithmetic::inc_bc(CPU* cpu){
-    cpu->reg_BC++;
+    cpu->regs.reg_BC++;
     return INC_BC_CYCLES;
 }
 
 cycles  Arithmetic::inc_de(CPU* cpu){
-    cpu->reg_DE++;
+    cpu->regs.reg_DE++;
     return INC_DE_CYCLES;
 }
 
 cycles Arithmetic::inc_hl(CPU* cpu){
-    cpu->reg_HL++;
+    cpu->regs.reg_HL++;
     return INC_HL_CYCLES;
 }
 
 cycles  Arithmetic::inc_sp(CPU* cpu){
-    cpu->SP++;
+    cpu->regs.SP++;
     return INC_SP_CYCLES;
 }
 
 cycles Arithmetic::dec_bc(CPU* cpu){
-    cpu->reg_BC--;
+    cpu->regs.reg_BC--;
     return DEC_BC_CYCLES;
 }
 
 cycles Arithmetic::dec_de(CPU* cpu){
-    cpu->reg_DE--;
+    cpu->regs.reg_DE--;
     return DEC_DE_CYCLES;
 }
 
 cycles Arithmetic::dec_hl(CPU* cpu){
-    cpu->reg_HL--;
+    cpu->regs.reg_HL--;
     return DEC_HL_CYCLES;
 }
 cycles Arithmetic::dec_sp(CPU* cpu){
-    cpu->SP--;
+    cpu->regs.SP--;
     return DEC_SP_CYCLES;
 }
 
 cycles Arithmetic::inc_a(CPU* cpu){
-    (*(cpu->A))++;
+    (cpu->regs.A)++;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A)==0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, cpu->regs.A);
 
     return INC_A_CYCLES;
 }
 
 
 cycles Arithmetic::inc_c(CPU* cpu){
-    (*(cpu->C))++;
+    (cpu->regs.C)++;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->C)==0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->C) & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, cpu->regs.C);
 
     return INC_C_CYCLES;
 }
 
 cycles Arithmetic::inc_b(CPU* cpu){
-    (*(cpu->B))++;
+    (cpu->regs.B)++;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->B)==0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->B) & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, cpu->regs.B);
 
     return INC_B_CYCLES;
 }
 
 cycles Arithmetic::inc_d(CPU* cpu){
-    (*(cpu->D))++;
+    (cpu->regs.D)++;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->D)==0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->D) & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, cpu->regs.D);
 
     return INC_D_CYCLES;
 }
 
 cycles Arithmetic::inc_e(CPU* cpu){
-    (*(cpu->E))++;
+    (cpu->regs.E)++;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->E)==0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->E) & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, cpu->regs.E);
 
     return INC_E_CYCLES;
 }
 
 cycles Arithmetic::inc_h(CPU* cpu){
-    (*(cpu->H))++;
+    (cpu->regs.H)++;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->H)==0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->H) & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, cpu->regs.H);
 
     return INC_H_CYCLES;
 }
 
 cycles Arithmetic::inc_l(CPU* cpu){
-    (*(cpu->L))++;
+    (cpu->regs.L)++;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->L)==0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->L) & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, cpu->regs.L);
 
     return INC_L_CYCLES;
 }
 
 cycles Arithmetic::dec_a(CPU* cpu){
-    (*(cpu->A))--;
+    (cpu->regs.A)--;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, cpu->regs.A);
 
     return DEC_A_CYCLES;
 }
 
 cycles Arithmetic::dec_b(CPU* cpu){
-    (*(cpu->B))--;
+    (cpu->regs.B)--;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->B) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->B) & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, cpu->regs.B);
 
     return DEC_B_CYCLES;
 }
 
 cycles Arithmetic::dec_c(CPU* cpu){
-    (*(cpu->C))--;
+    (cpu->regs.C)--;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->C) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->C) & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, cpu->regs.C);
 
     return DEC_C_CYCLES;
 }
 
 cycles Arithmetic::dec_d(CPU* cpu){
-    (*(cpu->D))--;
+    (cpu->regs.D)--;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->D) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->D) & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, cpu->regs.D);
 
     return DEC_D_CYCLES;
 }
 
 cycles Arithmetic::dec_e(CPU* cpu){
-    (*(cpu->E))--;
+    (cpu->regs.E)--;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->E) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->E) & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, cpu->regs.E);
 
     return DEC_E_CYCLES;
 }
 
 cycles Arithmetic::dec_h(CPU* cpu){
-    (*(cpu->H))--;
+    (cpu->regs.H)--;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->H) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->H) & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, cpu->regs.H);
 
     return DEC_H_CYCLES;
 }
 
 cycles Arithmetic::dec_l(CPU* cpu){
-    (*(cpu->L))--;
+    (cpu->regs.L)--;
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->L) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->L) & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, cpu->regs.L);
 
     return DEC_L_CYCLES;
 }
 
 cycles Arithmetic::add_hl_bc(CPU* cpu){
+    cpu->materializeFlags();
 
     //do arithmetic in a larger buffer so we can check for overflow
-    uint32_t result = (uint32_t) cpu->reg_HL.read() + (uint32_t) cpu->reg_BC.read(); 
+    uint32_t result = (uint32_t) cpu->regs.reg_HL + (uint32_t) cpu->regs.reg_BC; 
 
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
-    writeBit(*(cpu->F), FLAG_H, ((((cpu->reg_HL.read() & 0xFFF) + (cpu->reg_BC.read() & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.reg_HL & 0xFFF) + (cpu->regs.reg_BC & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
 
-    cpu->reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
+    cpu->regs.reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
 
     return ADD_HL_BC_CYCLES;
 }
@@ -218,1044 +191,1009 @@ cycles Arithmetic::add_hl_bc(CPU* cpu){
 
 
 cycles Arithmetic::add_hl_de(CPU* cpu){
+    cpu->materializeFlags();
     //do arithmetic in a larger buffer so we can check for overflow
-    uint32_t result = (uint32_t) cpu->reg_HL.read() + (uint32_t) cpu->reg_DE.read(); 
+    uint32_t result = (uint32_t) cpu->regs.reg_HL + (uint32_t) cpu->regs.reg_DE; 
 
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
-    writeBit(*(cpu->F), FLAG_H, ((((cpu->reg_HL.read() & 0xFFF) + (cpu->reg_DE.read() & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.reg_HL & 0xFFF) + (cpu->regs.reg_DE & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
 
-    cpu->reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
+    cpu->regs.reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
 
     return ADD_HL_DE_CYCLES;
 }
 
 cycles Arithmetic::add_hl_hl(CPU* cpu){
+    cpu->materializeFlags();
     //do arithmetic in a larger buffer so we can check for overflow
-    uint32_t result = (uint32_t) cpu->reg_HL.read() + (uint32_t) cpu->reg_HL.read(); 
+    uint32_t result = (uint32_t) cpu->regs.reg_HL + (uint32_t) cpu->regs.reg_HL; 
 
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
-    writeBit(*(cpu->F), FLAG_H, ((((cpu->reg_HL.read() & 0xFFF) + (cpu->reg_HL.read() & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.reg_HL & 0xFFF) + (cpu->regs.reg_HL & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
 
-    cpu->reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
+    cpu->regs.reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
 
     return ADD_HL_HL_CYCLES;
 }
 
 cycles Arithmetic::add_hl_sp(CPU* cpu){
+    cpu->materializeFlags();
     //do arithmetic in a larger buffer so we can check for overflow
-    uint32_t result = (uint32_t) cpu->reg_HL.read() + (uint32_t) cpu->SP.read(); 
+    uint32_t result = (uint32_t) cpu->regs.reg_HL + (uint32_t) cpu->regs.SP; 
 
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
-    writeBit(*(cpu->F), FLAG_H, ((((cpu->reg_HL.read() & 0xFFF) + (cpu->SP.read() & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, (result > 0xFFFF)); //carry flag if result is greater than a 16 bit number 
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.reg_HL & 0xFFF) + (cpu->regs.SP & 0xFFF)) > 0xFFF))); //half carry flag if the 12th bit overflows -> !!! maybe find a better method 
 
-    cpu->reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
+    cpu->regs.reg_HL = (word) (result & 0xFFFF); //take the bottom 16 bits 
 
     return ADD_HL_SP_CYCLES;
 }
 
 
  cycles Arithmetic::daa(CPU* cpu){ 
+    cpu->materializeFlags();
     byte correctionOffset = 0;
 
-    if(readBit(*(cpu->F), FLAG_C) || (!readBit(*(cpu->F), FLAG_N) && (*(cpu->A)) > 0x99)){
+    if(readBit(cpu->regs.F, FLAG_C) || (!readBit(cpu->regs.F, FLAG_N) && (cpu->regs.A) > 0x99)){
         correctionOffset |= 0x60;
-        writeBit(*(cpu->F), FLAG_C, 1);
+        writeBit(cpu->regs.F, FLAG_C, 1);
     } 
-    if(readBit(*(cpu->F), FLAG_H) || (!readBit(*(cpu->F), FLAG_N) && (*(cpu->A) & 0xF ) > 0x9 )){
+    if(readBit(cpu->regs.F, FLAG_H) || (!readBit(cpu->regs.F, FLAG_N) && (cpu->regs.A & 0xF ) > 0x9 )){
         correctionOffset |= 0x6;
     }
 
-    if(readBit(*(cpu->F), FLAG_N))  *(cpu->A)-=correctionOffset;
-    else *(cpu->A)+=correctionOffset;
+    if(readBit(cpu->regs.F, FLAG_N))  cpu->regs.A-=correctionOffset;
+    else cpu->regs.A+=correctionOffset;
 
-    writeBit(*(cpu->F), FLAG_Z,  *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_H, 0);
+    writeBit(cpu->regs.F, FLAG_Z,  cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_H, 0);
 
     return DAA_CYCLES;
  }
 
      
 cycles Arithmetic::inc_mhl(CPU* cpu){
-
-    byte temp = cpu->memory->read( cpu->reg_HL.read());
+    byte temp = cpu->memory->read( cpu->regs.reg_HL);
     temp++;
-    cpu->memory->write( cpu->reg_HL.read(), temp);
+    cpu->memory->write( cpu->regs.reg_HL, temp);
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, (temp & 0xF) == 0);
+    cpu->deferFlags(LAZY_FLAGS_INC, 0, 0, temp);
 
     return INC_mHL_CYCLES;
 }
 
 cycles Arithmetic::dec_mhl(CPU* cpu){
-
-    byte temp = cpu->memory->read( cpu->reg_HL.read());
+    byte temp = cpu->memory->read( cpu->regs.reg_HL);
     temp--;
-    cpu->memory->write( cpu->reg_HL.read(), temp);
+    cpu->memory->write( cpu->regs.reg_HL, temp);
 
     //update flags 
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (temp & 0xF) == 0xF);
+    cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, temp);
 
     return DEC_mHL_CYCLES;
 }
 
 cycles Arithmetic::add_a_a(CPU* cpu){
-    word result = *(cpu->A) + *(cpu->A);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.A;
+    cpu->regs.A = lhs + rhs;
 
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
-
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->A) & 0xF)) > 0xF)));
-
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_A_CYCLES;
 }
 
 cycles Arithmetic::add_a_b(CPU* cpu){
-    word result = *(cpu->A) + *(cpu->B);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.B;
+    cpu->regs.A = lhs + rhs;
 
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
-
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->B) & 0xF)) > 0xF)));
-
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_B_CYCLES;
 }
 
 cycles Arithmetic::add_a_c(CPU* cpu){
-    word result = *(cpu->A) + *(cpu->C);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.C;
+    cpu->regs.A = lhs + rhs;
 
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
-
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->C) & 0xF)) > 0xF)));
-
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_C_CYCLES;
 }
 
 cycles Arithmetic::add_a_d(CPU* cpu){
-    word result = *(cpu->A) + *(cpu->D);
-
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
-
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->D) & 0xF)) > 0xF)));
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.D;
+    cpu->regs.A = lhs + rhs;
 
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_D_CYCLES;
 }
 
 cycles Arithmetic::add_a_e(CPU* cpu){
-    word result = *(cpu->A) + *(cpu->E);
-
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
-
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->E) & 0xF)) > 0xF)));
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.E;
+    cpu->regs.A = lhs + rhs;
 
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_E_CYCLES;
 }
 
 cycles Arithmetic::add_a_h(CPU* cpu){
-    word result = *(cpu->A) + *(cpu->H);
-
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.H;
+    cpu->regs.A = lhs + rhs;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->H) & 0xF)) > 0xF)));
-
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_H_CYCLES;
 }
 
 cycles Arithmetic::add_a_l(CPU* cpu){
-    word result = *(cpu->A) + *(cpu->L);
-
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.L;
+    cpu->regs.A = lhs + rhs;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->L) & 0xF)) > 0xF)));
-
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_L_CYCLES;
 }
 
 cycles Arithmetic::add_a_mhl(CPU* cpu){
-    byte data = cpu->memory->read(cpu->reg_HL.read());
-    word result = *(cpu->A) + data;
-
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->memory->read(cpu->regs.reg_HL);
+    cpu->regs.A = lhs + rhs;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (data & 0xF)) > 0xF)));
-
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_mHL_CYCLES;
 }
 
 cycles Arithmetic::adc_a_a(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + *(cpu->A) + CY;
+    word result = cpu->regs.A + cpu->regs.A + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->A) & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->regs.A & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_A_CYCLES;
 }
 
 cycles Arithmetic::adc_a_b(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + *(cpu->B) + CY;
+    word result = cpu->regs.A + cpu->regs.B + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->B) & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->regs.B & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_B_CYCLES;
 }
 
 cycles Arithmetic::adc_a_c(CPU* cpu){
+    cpu->materializeFlags();
     
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + *(cpu->C) + CY;
+    word result = cpu->regs.A + cpu->regs.C + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->C) & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->regs.C & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_C_CYCLES;
 }
 
 cycles Arithmetic::adc_a_d(CPU* cpu){
+    cpu->materializeFlags();
     
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + *(cpu->D) + CY;
+    word result = cpu->regs.A + cpu->regs.D + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->D) & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->regs.D & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_D_CYCLES;
 }
 
 cycles Arithmetic::adc_a_e(CPU* cpu){
+    cpu->materializeFlags();
     
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + *(cpu->E) + CY;
+    word result = cpu->regs.A + cpu->regs.E + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->E) & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->regs.E & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_E_CYCLES;
 }
 
 cycles Arithmetic::adc_a_h(CPU* cpu){
+    cpu->materializeFlags();
     
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + *(cpu->H) + CY;
+    word result = cpu->regs.A + cpu->regs.H + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->H) & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->regs.H & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_H_CYCLES;
 }
 
 cycles Arithmetic::adc_a_l(CPU* cpu){
+    cpu->materializeFlags();
     
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + *(cpu->L) + CY;
+    word result = cpu->regs.A + cpu->regs.L + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (*(cpu->L) & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->regs.L & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_L_CYCLES;
 }
 
 cycles Arithmetic::adc_a_mhl(CPU* cpu){
+    cpu->materializeFlags();
     
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    byte data = cpu->memory->read(cpu->reg_HL.read());
-    word result = *(cpu->A) + data + CY;
+    byte data = cpu->memory->read(cpu->regs.reg_HL);
+    word result = cpu->regs.A + data + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (data & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (data & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_mHL_CYCLES;
 }
 
 cycles Arithmetic::sub_a_a(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.A;
+    cpu->regs.A = lhs - rhs;
 
-    *(cpu->A) = 0;
-    *(cpu->F) = 0b11000000; //set Z=1,N=1,H=0,C=0
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_A_CYCLES;
 }
 
 cycles Arithmetic::sub_a_b(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.B;
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-
-    *(cpu->A) = *(cpu->A) - *(cpu->B);
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->B) & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->B));
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_B_CYCLES;
 }
 
 cycles Arithmetic::sub_a_c(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.C;
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-
-    *(cpu->A) = *(cpu->A) - *(cpu->C);
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->C) & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->C));
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_C_CYCLES;
 }
 cycles Arithmetic::sub_a_d(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.D;
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-
-    *(cpu->A) = *(cpu->A) - *(cpu->D);
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->D) & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->D));
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_D_CYCLES;
 }
 cycles Arithmetic::sub_a_e(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.E;
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-
-    *(cpu->A) = *(cpu->A) - *(cpu->E);
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->E) & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->E));
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_E_CYCLES;
 }
 cycles Arithmetic::sub_a_h(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.H;
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-
-    *(cpu->A) = *(cpu->A) - *(cpu->H);
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->H) & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->H));
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_H_CYCLES;
 }
 cycles Arithmetic::sub_a_l(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.L;
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-
-    *(cpu->A) = *(cpu->A) - *(cpu->L);
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->L) & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->L));
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_L_CYCLES;
 }
 
 cycles Arithmetic::sub_a_mhl(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->memory->read(cpu->regs.reg_HL);
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-    byte data = cpu->memory->read(cpu->reg_HL.read());
-
-    *(cpu->A) = *(cpu->A) - data;
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (data & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < data);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_mHL_CYCLES;
 }
 
 
 cycles Arithmetic::sbc_a_a(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C);
-    *(cpu->A) = 0 - CY;
+    bool CY = readBit(cpu->regs.F, FLAG_C);
+    cpu->regs.A = 0 - CY;
    
-    writeBit(*(cpu->F), FLAG_Z, !CY);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, CY);
-    writeBit(*(cpu->F), FLAG_C, CY);
+    writeBit(cpu->regs.F, FLAG_Z, !CY);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H, CY);
+    writeBit(cpu->regs.F, FLAG_C, CY);
 
     return SBC_A_A_CYCLES;
 }
 
 cycles Arithmetic::sbc_a_b(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C);    
-    byte temp = *(cpu->A);
+    bool CY = readBit(cpu->regs.F, FLAG_C);    
+    byte temp = cpu->regs.A;
 
-    *(cpu->A) = *(cpu->A) - *(cpu->B) - CY;
+    cpu->regs.A = cpu->regs.A - cpu->regs.B - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->B) & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->B) + CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (cpu->regs.B & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < cpu->regs.B + CY);
 
     return SBC_A_B_CYCLES;
 }
 
 cycles Arithmetic::sbc_a_c(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C);    
-    byte temp = *(cpu->A);
+    bool CY = readBit(cpu->regs.F, FLAG_C);    
+    byte temp = cpu->regs.A;
 
-    *(cpu->A) = *(cpu->A) - *(cpu->C) - CY;
+    cpu->regs.A = cpu->regs.A - cpu->regs.C - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->C) & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->C) + CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (cpu->regs.C & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < cpu->regs.C + CY);
 
     return SBC_A_C_CYCLES;
 }
 cycles Arithmetic::sbc_a_d(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C); 
-    byte temp = *(cpu->A);
+    bool CY = readBit(cpu->regs.F, FLAG_C); 
+    byte temp = cpu->regs.A;
 
-    *(cpu->A) = *(cpu->A) - *(cpu->D) - CY;
+    cpu->regs.A = cpu->regs.A - cpu->regs.D - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->D) & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->D) + CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (cpu->regs.D & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < cpu->regs.D + CY);
 
     return SBC_A_D_CYCLES;
 }
 cycles Arithmetic::sbc_a_e(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C); 
-    byte temp = *(cpu->A);
+    bool CY = readBit(cpu->regs.F, FLAG_C); 
+    byte temp = cpu->regs.A;
 
-    *(cpu->A) = *(cpu->A) - *(cpu->E) - CY;
+    cpu->regs.A = cpu->regs.A - cpu->regs.E - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->E) & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->E) + CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (cpu->regs.E & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < cpu->regs.E + CY);
 
     return SBC_A_E_CYCLES;
 }
 cycles Arithmetic::sbc_a_h(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C); 
-    byte temp = *(cpu->A);
+    bool CY = readBit(cpu->regs.F, FLAG_C); 
+    byte temp = cpu->regs.A;
 
-    *(cpu->A) = *(cpu->A) - *(cpu->H) - CY;
+    cpu->regs.A = cpu->regs.A - cpu->regs.H - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->H) & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->H )+ CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (cpu->regs.H & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < cpu->regs.H + CY);
 
     return SBC_A_H_CYCLES;
 }
 cycles Arithmetic::sbc_a_l(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C); 
-    byte temp = *(cpu->A);
+    bool CY = readBit(cpu->regs.F, FLAG_C); 
+    byte temp = cpu->regs.A;
 
-    *(cpu->A) = *(cpu->A) - *(cpu->L) - CY;
+    cpu->regs.A = cpu->regs.A - cpu->regs.L - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (*(cpu->L) & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < *(cpu->L)+ CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (cpu->regs.L & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < cpu->regs.L+ CY);
 
     return SBC_A_L_CYCLES;
 }
 
 cycles Arithmetic::sbc_a_mhl(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C); 
-    byte temp = *(cpu->A);
-    byte data = cpu->memory->read(cpu->reg_HL.read());
+    bool CY = readBit(cpu->regs.F, FLAG_C); 
+    byte temp = cpu->regs.A;
+    byte data = cpu->memory->read(cpu->regs.reg_HL);
 
-    *(cpu->A) = *(cpu->A) - data - CY;
+    cpu->regs.A = cpu->regs.A - data - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (data & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < data + CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (data & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < data + CY);
 
     return SBC_A_mHL_CYCLES;
 }
 
 cycles Arithmetic::and_a_a(CPU* cpu){
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.A;
+    cpu->regs.A = lhs & rhs;
+
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_A_CYCLES;
 }
 
 cycles Arithmetic::and_a_b(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.B;
+    cpu->regs.A = lhs & rhs;
 
-    *(cpu->A) = *(cpu->A) & *(cpu->B);
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_B_CYCLES;
 }
 
 cycles Arithmetic::and_a_c(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.C;
+    cpu->regs.A = lhs & rhs;
 
-    *(cpu->A) = *(cpu->A) & *(cpu->C);
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_C_CYCLES;
 }
 
 cycles Arithmetic::and_a_d(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.D;
+    cpu->regs.A = lhs & rhs;
 
-    *(cpu->A) = *(cpu->A) & *(cpu->D);
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_D_CYCLES;
 }
 
 cycles Arithmetic::and_a_e(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.E;
+    cpu->regs.A = lhs & rhs;
 
-    *(cpu->A) = *(cpu->A) & *(cpu->E);
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_E_CYCLES;
 }
 
 cycles Arithmetic::and_a_h(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.H;
+    cpu->regs.A = lhs & rhs;
 
-    *(cpu->A) = *(cpu->A) & *(cpu->H);
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_H_CYCLES;
 }
 
 cycles Arithmetic::and_a_l(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.L;
+    cpu->regs.A = lhs & rhs;
 
-    *(cpu->A) = *(cpu->A) & *(cpu->L);
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_L_CYCLES;
 }
 
 cycles Arithmetic::and_a_mhl(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->memory->read(cpu->regs.reg_HL);
+    cpu->regs.A = lhs & rhs;
 
-    byte data = cpu->memory->read(cpu->reg_HL.read());
-    *(cpu->A) = *(cpu->A) & data;
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_mHL_CYCLES;
 }
 
 cycles Arithmetic::xor_a_a(CPU* cpu){
-    *(cpu->A) = *(cpu->A) ^ *(cpu->A);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.A;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_A_CYCLES;
 }
 
 cycles Arithmetic::xor_a_b(CPU* cpu){
-    *(cpu->A) = *(cpu->A) ^ *(cpu->B);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.B;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_B_CYCLES;
 }
 
 cycles Arithmetic::xor_a_c(CPU* cpu){
-    *(cpu->A) = *(cpu->A) ^ *(cpu->C);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.C;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_C_CYCLES;
 }
 
 cycles Arithmetic::xor_a_d(CPU* cpu){
-    *(cpu->A) = *(cpu->A) ^ *(cpu->D);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.D;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_D_CYCLES;
 }
 
 cycles Arithmetic::xor_a_e(CPU* cpu){
-    *(cpu->A) = *(cpu->A) ^ *(cpu->E);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.E;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_E_CYCLES;
 }
 
-cycles Arithmetic::xor_a_h(CPU* cpu)
-{
-    *(cpu->A) = *(cpu->A) ^ *(cpu->H);
+cycles Arithmetic::xor_a_h(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.H;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_H_CYCLES;
 }
 
 cycles Arithmetic::xor_a_l(CPU* cpu){
-    *(cpu->A) = *(cpu->A) ^ *(cpu->L);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.L;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_L_CYCLES;
 }
 
 cycles Arithmetic::xor_a_mhl(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->memory->read(cpu->regs.reg_HL);
+    cpu->regs.A = lhs ^ rhs;
 
-    byte data = cpu->memory->read(cpu->reg_HL.read());
-    *(cpu->A) = *(cpu->A) ^ data;
-
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_mHL_CYCLES;
 }
 
 cycles Arithmetic::or_a_a(CPU* cpu){
-    *(cpu->A) = *(cpu->A) | *(cpu->A);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.A;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_A_CYCLES;
 }
 
 cycles Arithmetic::or_a_b(CPU* cpu){
-    *(cpu->A) = *(cpu->A) | *(cpu->B);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.B;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_B_CYCLES;
 }
 
 cycles Arithmetic::or_a_c(CPU* cpu){
-    *(cpu->A) = *(cpu->A) | *(cpu->C);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.C;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_C_CYCLES;
 }
 
 cycles Arithmetic::or_a_d(CPU* cpu){
-    *(cpu->A) = *(cpu->A) | *(cpu->D);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.D;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_D_CYCLES;
 }
 
 cycles Arithmetic::or_a_e(CPU* cpu){
-    *(cpu->A) = *(cpu->A) | *(cpu->E);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.E;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_E_CYCLES;
 }
 
-cycles Arithmetic::or_a_h(CPU* cpu)
-{
-    *(cpu->A) = *(cpu->A) | *(cpu->H);
+cycles Arithmetic::or_a_h(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.H;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_H_CYCLES;
 }
 
 cycles Arithmetic::or_a_l(CPU* cpu){
-    *(cpu->A) = *(cpu->A) | *(cpu->L);
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.L;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_L_CYCLES;
 }
 
 cycles Arithmetic::or_a_mhl(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->memory->read(cpu->regs.reg_HL);
+    cpu->regs.A = lhs | rhs;
 
-    byte data = cpu->memory->read(cpu->reg_HL.read());
-    *(cpu->A) = *(cpu->A) | data;
-
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_mHL_CYCLES;
 }
 
 cycles Arithmetic::cp_a_a(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.A;
+
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
-    *(cpu->F) = 0b11000000; //set Z=1,N=1,H=0,C=0
     return CP_A_CYCLES;
 }
 
 cycles Arithmetic::cp_a_b(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.B;
 
-    byte temp = *(cpu->A) - *(cpu->B);
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (*(cpu->B) & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < *(cpu->B));
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_B_CYCLES;
 }
 
 cycles Arithmetic::cp_a_c(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.C;
 
-    byte temp = *(cpu->A) - *(cpu->C);
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (*(cpu->C) & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < *(cpu->C));
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_C_CYCLES;
 }
 cycles Arithmetic::cp_a_d(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.D;
 
-    byte temp = *(cpu->A) - *(cpu->D);
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (*(cpu->D) & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < *(cpu->D));
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_D_CYCLES;
 }
 cycles Arithmetic::cp_a_e(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.E;
 
-    byte temp = *(cpu->A) - *(cpu->E);
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (*(cpu->E) & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < *(cpu->E));
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_E_CYCLES;
 }
 cycles Arithmetic::cp_a_h(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.H;
 
-    byte temp = *(cpu->A) - *(cpu->H);
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (*(cpu->H) & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < *(cpu->H));
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_H_CYCLES;
 }
 cycles Arithmetic::cp_a_l(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->regs.L;
 
-    byte temp = *(cpu->A) - *(cpu->L);
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (*(cpu->L) & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < *(cpu->L));
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_L_CYCLES;
 }
 
 cycles Arithmetic::cp_a_mhl(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = cpu->memory->read(cpu->regs.reg_HL);
 
-    byte data = cpu->memory->read(cpu->reg_HL.read());
-    byte temp = *(cpu->A) - data;
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (data  & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < data);
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_mHL_CYCLES;
 }
 
 cycles Arithmetic::add_a_d8(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = (byte)cpu->parsedData;
+    cpu->regs.A = lhs + rhs;
 
-    word result = *(cpu->A) + cpu->parsedData;
-
-    bool carry = result > 0xFF;
-    
-    result = result & 0xFF;
-
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (cpu->parsedData & 0xF)) > 0xF)));
-
-    *(cpu->A) = (byte) result;
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_ADD, lhs, rhs, cpu->regs.A);
 
     return ADD_A_d8_CYCLES;
 }
 
 cycles Arithmetic::adc_a_d8(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C);
+    bool CY = readBit(cpu->regs.F, FLAG_C);
 
-    word result = *(cpu->A) + cpu->parsedData + CY;
+    word result = cpu->regs.A + cpu->parsedData + CY;
 
     bool carry = result > 0xFF;
     
     result = result & 0xFF;
 
-    writeBit(*(cpu->F), FLAG_Z, result == 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, carry);
-    writeBit(*(cpu->F), FLAG_H, ((((*(cpu->A) & 0xF) + (cpu->parsedData & 0xF) + CY) > 0xF)));
+    writeBit(cpu->regs.F, FLAG_Z, result == 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, carry);
+    writeBit(cpu->regs.F, FLAG_H, ((((cpu->regs.A & 0xF) + (cpu->parsedData & 0xF) + CY) > 0xF)));
 
-    *(cpu->A) = (byte) result;
+    cpu->regs.A = (byte) result;
 
     return ADC_A_d8_CYCLES;
 }
 
 cycles Arithmetic::and_a_d8(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = (byte)cpu->parsedData;
+    cpu->regs.A = lhs & rhs;
 
-    *(cpu->A) = *(cpu->A) & cpu->parsedData;
-
-    *(cpu->F) = 0b00100000; //set N=0, H=1, C=0
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_AND, lhs, rhs, cpu->regs.A);
 
     return AND_d8_CYCLES;
 }
 
 cycles Arithmetic::xor_a_d8(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = (byte)cpu->parsedData;
+    cpu->regs.A = lhs ^ rhs;
 
-    *(cpu->A) = *(cpu->A) ^ cpu->parsedData;
-
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return XOR_d8_CYCLES;
 }
 
 cycles Arithmetic::sbc_a_d8(CPU* cpu){
+    cpu->materializeFlags();
 
-    bool CY = readBit(*(cpu->F), FLAG_C); 
-    byte temp = *(cpu->A);
+    bool CY = readBit(cpu->regs.F, FLAG_C); 
+    byte temp = cpu->regs.A;
 
-    *(cpu->A) = *(cpu->A) - cpu->parsedData - CY;
+    cpu->regs.A = cpu->regs.A - cpu->parsedData - CY;
 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (cpu->parsedData & 0xF) + CY);
-    writeBit(*(cpu->F), FLAG_C,  temp < cpu->parsedData + CY);
+    writeBit(cpu->regs.F, FLAG_Z, cpu->regs.A == 0);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H,  (temp & 0xF) < (cpu->parsedData & 0xF) + CY);
+    writeBit(cpu->regs.F, FLAG_C,  temp < cpu->parsedData + CY);
 
     return SBC_A_d8_CYCLES;
 }
 
 cycles Arithmetic::sub_a_d8(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = (byte)cpu->parsedData;
+    cpu->regs.A = lhs - rhs;
 
-    byte temp = *(cpu->A);
-
-    *(cpu->A) = *(cpu->A) - cpu->parsedData;
-
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H,  (temp & 0xF) < (cpu->parsedData & 0xF));
-    writeBit(*(cpu->F), FLAG_C,  temp < cpu->parsedData);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, cpu->regs.A);
 
     return SUB_d8_CYCLES;
 }
 
 cycles Arithmetic::or_a_d8(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = (byte)cpu->parsedData;
+    cpu->regs.A = lhs | rhs;
 
-    *(cpu->A) = *(cpu->A) | cpu->parsedData;
-
-    *(cpu->F) = 0; //set all flags to 0 
-    writeBit(*(cpu->F), FLAG_Z, *(cpu->A) == 0);
+    //update flags 
+    cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
 
     return OR_d8_CYCLES;
 }
 
 cycles Arithmetic::cp_a_d8(CPU* cpu){
+    byte lhs = cpu->regs.A;
+    byte rhs = (byte)cpu->parsedData;
 
-    byte temp = *(cpu->A) - cpu->parsedData;
-
-    writeBit(*(cpu->F), FLAG_Z, temp == 0);
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, (*(cpu->A) & 0xF) < (cpu->parsedData & 0xF));
-    writeBit(*(cpu->F), FLAG_C, *(cpu->A) < cpu->parsedData);
+    //update flags, A is left untouched 
+    cpu->deferFlags(LAZY_FLAGS_SUB, lhs, rhs, lhs - rhs);
 
     return CP_d8_CYCLES;
 }
 
 cycles Arithmetic::add_sp_r8(CPU* cpu){
+    cpu->materializeFlags();
 
     signedByte imm8 = (signedByte) cpu->parsedData;
 
-    writeBit(*(cpu->F), FLAG_Z, 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, (( cpu->SP.read() & 0xFF) + (imm8 & 0xFF)) > 0xFF);
-    writeBit(*(cpu->F), FLAG_H, (((cpu->SP.read() & 0xF ) + (imm8 & 0xF )) > 0xF));
+    writeBit(cpu->regs.F, FLAG_Z, 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, (( cpu->regs.SP & 0xFF) + (imm8 & 0xFF)) > 0xFF);
+    writeBit(cpu->regs.F, FLAG_H, (((cpu->regs.SP & 0xF ) + (imm8 & 0xF )) > 0xF));
 
-    cpu->SP = (word)(cpu->SP.read() + imm8);
+    cpu->regs.SP = (word)(cpu->regs.SP + imm8);
     return ADD_SP_r8_CYCLES;
 }
\ No newline at end of file
@@ -9,253 +9,175 @@ date: 2021-11-13
 
 
 cycles Bit::rlca(CPU* cpu){
+    cpu->materializeFlags();
 
-    byte bit7 = readBit(*(cpu->A), 7);
-    *(cpu->A) = (*(cpu->A) << 1) | bit7; //rotates to the left 
+    byte bit7 = readBit(cpu->regs.A, 7);
+    cpu->regs.A = (cpu->regs.A << 1) | bit7; //rotates to the left 
 
-    writeBit(*(cpu->F), FLAG_Z, 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, 0); 
-    writeBit(*(cpu->F), FLAG_C, bit7); 
+    writeBit(cpu->regs.F, FLAG_Z, 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_H, 0); 
+    writeBit(cpu->regs.F, FLAG_C, bit7); 
 
     return RLCA_CYCLES;
 }
 
 cycles Bit::rrca(CPU* cpu){
+    cpu->materializeFlags();
 
-    byte bit0 = readBit(*(cpu->A), 0);
+    byte bit0 = readBit(cpu->regs.A, 0);
 
-    *(cpu->A) = (*(cpu->A) >> 1) | (bit0<<7); //rotates to the right 
+    cpu->regs.A = (cpu->regs.A >> 1) | (bit0<<7); //rotates to the right 
 
-    writeBit(*(cpu->F), FLAG_Z, 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, 0); 
-    writeBit(*(cpu->F), FLAG_C, bit0); 
+    writeBit(cpu->regs.F, FLAG_Z, 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_H, 0); 
+    writeBit(cpu->regs.F, FLAG_C, bit0); 
 
     return RRCA_CYCLES;
 }
 
 cycles Bit::rla(CPU* cpu){
+    cpu->materializeFlags();
 
-    byte bit7 = readBit(*(cpu->A), 7);
-    byte oldCarry = readBit(*(cpu->F), FLAG_C);
-    *(cpu->A) = (*(cpu->A) << 1) | oldCarry; //rotates to the left 
+    byte bit7 = readBit(cpu->regs.A, 7);
+    byte oldCarry = readBit(cpu->regs.F, FLAG_C);
+    cpu->regs.A = (cpu->regs.A << 1) | oldCarry; //rotates to the left 
 
-    writeBit(*(cpu->F), FLAG_Z, 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, 0); 
-    writeBit(*(cpu->F), FLAG_C, bit7); 
+    writeBit(cpu->regs.F, FLAG_Z, 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_H, 0); 
+    writeBit(cpu->regs.F, FLAG_C, bit7); 
 
     return RLA_CYCLES;
 }
 
 cycles Bit::rra(CPU* cpu){
+    cpu->materializeFlags();
 
-    byte oldCarry = readBit(*(cpu->F), FLAG_C);
-    byte bit0 = readBit(*(cpu->A), 0);
+    byte oldCarry = readBit(cpu->regs.F, FLAG_C);
+    byte bit0 = readBit(cpu->regs.A, 0);
 
-    *(cpu->A) = (*(cpu->A) >> 1) | (oldCarry<<7); //rotates to the right 
+    cpu->regs.A = (cpu->regs.A >> 1) | (oldCarry<<7); //rotates to the right 
 
-    writeBit(*(cpu->F), FLAG_Z, 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, 0); 
-    writeBit(*(cpu->F), FLAG_C, bit0); 
+    writeBit(cpu->regs.F, FLAG_Z, 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_H, 0); 
+    writeBit(cpu->regs.F, FLAG_C, bit0); 
 
     return RRA_CYCLES;
 }
 
 
 cycles Bit::cpl(CPU* cpu){
+    cpu->materializeFlags();
 
-    *(cpu->A) = ~(*(cpu->A));
+    cpu->regs.A = ~(cpu->regs.A);
 
-    writeBit(*(cpu->F), FLAG_N, 1);
-    writeBit(*(cpu->F), FLAG_H, 1);
+    writeBit(cpu->regs.F, FLAG_N, 1);
+    writeBit(cpu->regs.F, FLAG_H, 1);
     return CPL_CYCLES;
 }
 
 cycles Bit::scf(CPU* cpu){
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, 0);
-    writeBit(*(cpu->F), FLAG_C, 1);
+    cpu->materializeFlags();
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_H, 0);
+    writeBit(cpu->regs.F, FLAG_C, 1);
     
     return SCF_CYCLES;
 }
 
 
 cycles Bit::ccf(CPU* cpu){
+    cpu->materializeFlags();
 
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_H, 0);
-    writeBit(*(cpu->F), FLAG_C, !(readBit(*(cpu->F), FLAG_C)));
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_H, 0);
+    writeBit(cpu->regs.F, FLAG_C, !(readBit(cpu->regs.F, FLAG_C)));
     
     return CCF_CYCLES;
 }
 
 cycles Bit::prefix_cb(CPU* cpu){
+    // The CB opcode is fetched as the instruction's immediate data.
+    return CB_HANDLERS[cpu->parsedData & 0xFF](cpu);
+}
 
-    cycles usedCycles = NORMAL_CYCLES;
-
-    byte opCode = cpu->memory->read(cpu->PC.read());
-    cpu->PC++;
-
-    byte insType = (opCode & 0xF8)>>3; // extract the instuction type 
-    byte regNumber  = (opCode & 0x7); // extract the regs
-    byte bitNumber = (opCode & 0x38)>>3; //extract the bit number
-
-    byte memoryReg = 0;
-    reg8 regOperand;
-    
-    bool modifyingMem = false;   
-    word address;
-
-    switch(regNumber){
-        case 0x0:
-            regOperand = cpu->B;
-            break;
-
-        case 0x1:
-            regOperand = cpu->C;
-            break;
-
-        case 0x2:
-            regOperand = cpu->D;
-            break;
-
-        case 0x3:
-            regOperand = cpu->E;
-            break;
-        
-        case 0x4:
-            regOperand = cpu->H;
-            break;
-
-        case 0x5: 
-            regOperand = cpu->L;
-            break;
-
-        case 0x6:
-            address = cpu->reg_HL.read();
-            memoryReg = cpu->memory->read(address);
-            regOperand = &memoryReg;
-            modifyingMem = true;
-            usedCycles += mHL_CYCLES;
-            break;
-
-        case 0x7:
-            regOperand = cpu->A;
-            break;
-
-        default:
-            regOperand = cpu->B;
-            break;
-    }
-       
-    if(insType ==  RLC){
-        byte bit7 = readBit(*(regOperand), 7);
-        *(regOperand) = (*(regOperand) << 1) | bit7; //rotates to the left 
-
-        writeBit(*(cpu->F), FLAG_Z, (*regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, bit7); 
-    }
-
-    else if(insType ==  RRC){
-        byte bit0 = readBit(*(regOperand), 0);
-
-        *(regOperand) = (*(regOperand) >> 1) | (bit0<<7); //rotates to the right 
-
-        writeBit(*(cpu->F), FLAG_Z, *(regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, bit0); 
-    }
-    
-    else if(insType ==  RL){
-        byte bit7 = readBit(*(regOperand), 7);
-        byte oldCarry = readBit(*(cpu->F), FLAG_C);
-        *(regOperand) = (*(regOperand) << 1) | oldCarry; //rotates to the left 
-
-        writeBit(*(cpu->F), FLAG_Z, *(regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, bit7); 
-    }
-
-    else if(insType ==  RR){
-        byte oldCarry = readBit(*(cpu->F), FLAG_C);
-        byte bit0 = readBit(*(regOperand), 0);
-
-        *(regOperand) = (*(regOperand) >> 1) | (oldCarry<<7); //rotates to the right 
-
-        writeBit(*(cpu->F), FLAG_Z, *(regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, bit0); 
-    }
-
-    else if(insType ==  SLA){
-        byte bit7 = readBit(*(regOperand), 7);
-        *(regOperand) = (*(regOperand) << 1); //shifts to the left 
-
-        writeBit(*(cpu->F), FLAG_Z, (*regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, bit7);  
-    }
-
-    else if(insType ==  SRA){
-        byte bit0 = readBit(*(regOperand), 0);
-        byte bit7 = readBit(*(regOperand), 7);
-
-        *(regOperand) = (*(regOperand) >> 1) | (bit7 << 7); //airithmetic shifts to the right 
-
-        writeBit(*(cpu->F), FLAG_Z, *(regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, bit0); 
-    }
-
-    else if(insType ==  SWAP){
-        byte temp  =  *(regOperand) >> 4;
-        *(regOperand) = *(regOperand) << 4 | temp; //swaps the top and bottom nybbles 
-
-        writeBit(*(cpu->F), FLAG_Z, *(regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, 0); 
-    }
-
-    else if(insType ==  SRL){
-        byte bit0 = readBit(*(regOperand), 0);
-
-        *(regOperand) = (*(regOperand) >> 1); //shifts to the right 
-
-        writeBit(*(cpu->F), FLAG_Z, *(regOperand) == 0);
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 0); 
-        writeBit(*(cpu->F), FLAG_C, bit0); 
-    }
-
-    else if(insType >=  BIT && insType < RES){
-        writeBit(*(cpu->F), FLAG_Z, !readBit(*(regOperand), bitNumber));
-        writeBit(*(cpu->F), FLAG_N, 0);
-        writeBit(*(cpu->F), FLAG_H, 1); 
+template<byte insType>
+byte Bit::rotateOrShift(CPU* cpu, byte value){
+    byte result;
+    bool carry;
+
+    if constexpr (insType == RLC){
+        result = (value << 1) | (value >> 7); //rotates to the left 
+        carry = value >> 7;
+    } else if constexpr (insType == RRC){
+        result = (value >> 1) | (value << 7); //rotates to the right 
+        carry = value & 0x1;
+    } else if constexpr (insType == RL){
+        result = (value << 1) | readBit(cpu->regs.F, FLAG_C); //rotates to the left through carry 
+        carry = value >> 7;
+    } else if constexpr (insType == RR){
+        result = (value >> 1) | (readBit(cpu->regs.F, FLAG_C) << 7); //rotates to the right through carry 
+        carry = value & 0x1;
+    } else if constexpr (insType == SLA){
+        result = value << 1; //shifts to the left 
+        carry = value >> 7;
+    } else if constexpr (insType == SRA){
+        result = (value >> 1) | (value & 0x80); //airithmetic shifts to the right 
+        carry = value & 0x1;
+    } else if constexpr (insType == SWAP){
+        result = (value << 4) | (value >> 4); //swaps the top and bottom nybbles 
+        carry = false;
+    } else {
+        result = value >> 1; //shifts to the right 
+        carry = value & 0x1;
     }
 
-    else if(insType >=  RES && insType < SET){
-          writeBit(*(regOperand), bitNumber, 0);
-    }
+    // N and H are always cleared.
+    cpu->regs.F = ((result == 0) << FLAG_Z) | (carry << FLAG_C);
+    return result;
+}
 
-    else{
-        writeBit(*(regOperand), bitNumber, 1);
+template<byte opcode>
+cycles Bit::cbHandler(CPU* cpu){
+    constexpr byte insType = opcode >> 3; // extract the instuction type 
+    constexpr byte regNumber = opcode & 0x7; // extract the regs
+    constexpr byte bitNumber = (opcode >> 3) & 0x7; //extract the bit number
+
+    // Pick the operand: B, C, D, E, H, L, (HL), A.
+    byte* operand = nullptr;
+    if constexpr (regNumber == 0x0) operand = &cpu->regs.B;
+    else if constexpr (regNumber == 0x1) operand = &cpu->regs.C;
+    else if constexpr (regNumber == 0x2) operand = &cpu->regs.D;
+    else if constexpr (regNumber == 0x3) operand = &cpu->regs.E;
+    else if constexpr (regNumber == 0x4) operand = &cpu->regs.H;
+    else if constexpr (regNumber == 0x5) operand = &cpu->regs.L;
+    else if constexpr (regNumber == 0x7) operand = &cpu->regs.A;
+    constexpr bool modifyingMem = regNumber == 0x6;
+
+    byte value;
+    if constexpr (modifyingMem) value = cpu->memory->read(cpu->regs.reg_HL);
+    else value = *operand;
+
+    if constexpr (insType >= BIT && insType < RES){
+        // Only the carry flag is kept, nothing is written back.
+        cpu->materializeFlags();
+        cpu->regs.F = (!readBit(value, bitNumber) << FLAG_Z) | (1 << FLAG_H) | (cpu->regs.F & (1 << FLAG_C));
+    } else {
+        if constexpr (insType < BIT){
+            cpu->materializeFlags();
+            value = rotateOrShift<insType>(cpu, value);
+        } 
+        else if constexpr (insType < SET) writeBit(value, bitNumber, 0);
+        else writeBit(value, bitNumber, 1);
+
+        if constexpr (modifyingMem) cpu->memory->write(cpu->regs.reg_HL, value);
+        else *operand = value;
     }
 
-    // If operated on memory, ensure the appropriate handling is done.
-    if(modifyingMem){
-        cpu->memory->write(address, *(regOperand));
-    }
+    return modifyingMem ? NORMAL_CYCLES + mHL_CYCLES : NORMAL_CYCLES;
+}
 
-    return usedCycles;
-}
\ No newline at end of file
+const std::array<cbOperation, NUM_INSTRUCTIONS> Bit::CB_HANDLERS = makeCBHandlers(std::make_index_sequence<NUM_INSTRUCTIONS>());
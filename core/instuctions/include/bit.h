@@ -7,8 +7,12 @@ date: 2021-11-13
 */
 
 #include "..\..\include\defines.h"
+#include <array>
+#include <utility>
 class CPU; //foward declarration
 
+typedef cycles (*cbOperation)(CPU*);
+
 class Bit{
 public:
 
@@ -22,7 +26,7 @@ public:
     N 0
     H 0
     C Set according to result.*/
-    cycles rlca(CPU* cpu);
+    static cycles rlca(CPU* cpu);
 
     /*RRCA
     Rotate register A right.
@@ -34,7 +38,7 @@ public:
     N 0
     H 0
     C Set according to result.*/
-    cycles rrca(CPU* cpu);
+    static cycles rrca(CPU* cpu);
 
     /*RLA
     Rotate register A left through carry.
@@ -46,7 +50,7 @@ public:
     N 0
     H 0
     C Set according to result.*/
-    cycles rla(CPU* cpu);
+    static cycles rla(CPU* cpu);
 
     /*RRA
     Rotate register A right through carry.
@@ -58,7 +62,7 @@ public:
     N 0
     H 0
     C Set according to result.*/
-    cycles rra(CPU* cpu);
+    static cycles rra(CPU* cpu);
 
     /*
     CPL
@@ -68,7 +72,7 @@ public:
     Flags:
     N 1
     H 1*/
-    cycles cpl(CPU* cpu);
+    static cycles cpl(CPU* cpu);
 
 
     /*SCF
@@ -79,7 +83,7 @@ public:
     N 0
     H 0
     C 1*/
-    cycles scf(CPU* cpu);
+    static cycles scf(CPU* cpu);
 
     /*CCF
     Complement Carry Flag.
@@ -89,7 +93,7 @@ public:
     N 0
     H 0
     C Inverted. */
-    cycles ccf(CPU* cpu);
+    static cycles ccf(CPU* cpu);
 
     /*RLC r8
     Rotate register r8 left.
@@ -271,8 +275,30 @@ public:
     Cycles: 4
     Bytes: 2
     Flags: None affected.*/
-    cycles prefix_cb(CPU* cpu);
+    static cycles prefix_cb(CPU* cpu);
+
+    // The handlers of the CB prefixed instructions indexed by the byte following 0xCB.
+    static const std::array<cbOperation, NUM_INSTRUCTIONS> CB_HANDLERS;
+
+private:
+
+    /*
+    Runs the CB prefixed instruction `opcode`. The operation, operand and 
+    bit number are all decoded at compile time. The (HL) variants read and
+    write memory once, BIT only reads it.*/
+    template<byte opcode> static cycles cbHandler(CPU* cpu);
+
+    /*
+    Applies the rotate/shift `insType` (RLC to SRL) to `value`, updates all
+    flags and returns the result.*/
+    template<byte insType> static byte rotateOrShift(CPU* cpu, byte value);
 
+    /*
+    Builds the CB_HANDLERS table from one cbHandler per opcode.*/
+    template<std::size_t... opcodes>
+    static constexpr std::array<cbOperation, NUM_INSTRUCTIONS> makeCBHandlers(std::index_sequence<opcodes...>){
+        return {{&cbHandler<opcodes>...}};
+    }
 };
 
 #endif
\ No newline at end of file
@@ -15,7 +15,7 @@ class MiscAndControl{
     
 public:
     // A temp function for not supported operations .
-    cycles notSupported(CPU* cpu);
+    static cycles notSupported(CPU* cpu);
 
     /*
     NOP
@@ -23,7 +23,7 @@ public:
     Cycles: 1
     Bytes: 1
     Flags: None affected.*/
-    cycles nop(CPU* cpu);
+    static cycles nop(CPU* cpu);
 
     /*
     STOP
@@ -31,7 +31,7 @@ public:
     Cycles: -
     Bytes: 2
     Flags: None affected.*/
-    cycles stop(CPU* cpu);
+    static cycles stop(CPU* cpu);
 
     /*
     HALT
@@ -39,21 +39,21 @@ public:
     Cycles: -
     Bytes: 1
     Flags: None affected.*/
-    cycles halt(CPU* cpu);
+    static cycles halt(CPU* cpu);
 
     /*DI
     Disable Interrupts by clearing the IME flag.
     Cycles: 1
     Bytes: 1
     Flags: None affected.*/
-    cycles di(CPU* cpu);
+    static cycles di(CPU* cpu);
 
     /*EI
     Enable Interrupts by setting the IME flag. The flag is only set after the instruction following EI.
     Cycles: 1
     Bytes: 1
     Flags: None affected.*/
-    cycles ei(CPU* cpu);
+    static cycles ei(CPU* cpu);
 
 };
 
@@ -10,86 +10,86 @@ date: 2021-11-13
 
 
 cycles LoadAndStore::ld_bc_d16(CPU* cpu){
-    cpu->reg_BC = cpu->parsedData;
+    cpu->regs.reg_BC = cpu->parsedData;
     return LD_BC_d16_CYCLES;
 }
 
 cycles LoadAndStore::ld_de_d16(CPU* cpu){
-    cpu->reg_DE = cpu->parsedData;
+    cpu->regs.reg_DE = cpu->parsedData;
     return LD_DE_d16_CYCLES;
 }
 
 cycles LoadAndStore::ld_hl_d16(CPU* cpu){
-    cpu->reg_HL = cpu->parsedData;
+    cpu->regs.reg_HL = cpu->parsedData;
     return LD_HL_d16_CYCLES;
 }
 
 cycles LoadAndStore::ld_sp_d16(CPU* cpu){
-    cpu->SP = cpu->parsedData;
+    cpu->regs.SP = cpu->parsedData;
     return LD_SP_d16_CYCLES;
 }
 
 cycles LoadAndStore::ld_mbc_a(CPU* cpu){ 
-    cpu->memory->write(cpu->reg_BC.read(), *(cpu->A));
+    cpu->memory->write(cpu->regs.reg_BC, cpu->regs.A);
     return LD_mBC_A_CYCLES;
 }
 
     
 cycles LoadAndStore::ld_mde_a(CPU* cpu){
-    cpu->memory->write(cpu->reg_DE.read(), *(cpu->A));
+    cpu->memory->write(cpu->regs.reg_DE, cpu->regs.A);
     return LD_mDE_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_mhlp_a(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->A));
-    cpu->reg_HL++;
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.A);
+    cpu->regs.reg_HL++;
     return LD_mHLp_A_CYCLES;
 }
     
 cycles LoadAndStore::ld_mhls_a(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->A));
-    cpu->reg_HL--;
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.A);
+    cpu->regs.reg_HL--;
     return LD_mHLs_A_CYCLES;
 }
     
 cycles LoadAndStore::ld_a_d8(CPU* cpu){
-    *(cpu->A) = (byte) cpu->parsedData;
+    cpu->regs.A = (byte) cpu->parsedData;
     return LD_A_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_d8(CPU* cpu){
-    *(cpu->B) = (byte) cpu->parsedData;
+    cpu->regs.B = (byte) cpu->parsedData;
     return LD_B_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_d8(CPU* cpu){
-    *(cpu->C) = (byte) cpu->parsedData;
+    cpu->regs.C = (byte) cpu->parsedData;
     return LD_C_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_d8(CPU* cpu){
-    *(cpu->D) = (byte) cpu->parsedData;
+    cpu->regs.D = (byte) cpu->parsedData;
     return LD_D_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_d8(CPU* cpu){
-    *(cpu->E) = (byte) cpu->parsedData;
+    cpu->regs.E = (byte) cpu->parsedData;
     return LD_E_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_d8(CPU* cpu){
-    *(cpu->H) = (byte) cpu->parsedData;
+    cpu->regs.H = (byte) cpu->parsedData;
     return LD_H_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_d8(CPU* cpu){
-    *(cpu->L) = (byte) cpu->parsedData;
+    cpu->regs.L = (byte) cpu->parsedData;
     return LD_L_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_ma16_sp(CPU* cpu){
 
-    word dataToWrite = cpu->SP.read();
+    word dataToWrite = cpu->regs.SP;
     word addressToWrite = cpu->parsedData;
 
     cpu->memory->write(addressToWrite, dataToWrite & 0xFF); //bottom byte
@@ -99,7 +99,7 @@ cycles LoadAndStore::ld_ma16_sp(CPU* cpu){
 }
 
 cycles LoadAndStore::ldh_ma8_a(CPU* cpu){
-    byte dataToWrite = *(cpu->A);
+    byte dataToWrite = cpu->regs.A;
     word addressToWrite = cpu->parsedData | 0xFF00;
     cpu->memory->write(addressToWrite, dataToWrite); 
     return LDH_ma8_A_CYCLES;
@@ -109,448 +109,453 @@ cycles LoadAndStore::ldh_a_ma8(CPU* cpu){
 
     word addressToRead = cpu->parsedData | 0xFF00;
 
-    *(cpu->A) = cpu->memory->read(addressToRead); 
+    cpu->regs.A = cpu->memory->read(addressToRead); 
     return LDH_A_ma8_CYCLES;
 }
     
 cycles LoadAndStore::ld_a_mc(CPU* cpu){
 
-    word addressToRead = (*(cpu->C)) | 0xFF00;
+    word addressToRead = (cpu->regs.C) | 0xFF00;
 
-    *(cpu->A) = cpu->memory->read(addressToRead); 
+    cpu->regs.A = cpu->memory->read(addressToRead); 
 
     return LD_A_mC_CYCLES;
 }
 
 cycles LoadAndStore::ld_mc_a(CPU* cpu){
 
-    byte dataToWrite = *(cpu->A);
-    word addressToWrite = (*(cpu->C)) | 0xFF00;
+    byte dataToWrite = cpu->regs.A;
+    word addressToWrite = (cpu->regs.C) | 0xFF00;
     cpu->memory->write(addressToWrite, dataToWrite); 
 
     return LD_mC_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_mbc(CPU* cpu){
-    *(cpu->A) = cpu->memory->read(cpu->reg_BC.read());
+    cpu->regs.A = cpu->memory->read(cpu->regs.reg_BC);
     return LD_A_mBC_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_mde(CPU* cpu){
-    *(cpu->A) = cpu->memory->read(cpu->reg_DE.read());
+    cpu->regs.A = cpu->memory->read(cpu->regs.reg_DE);
     return LD_A_mDE_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_mhlp(CPU* cpu){
-    *(cpu->A) = cpu->memory->read(cpu->reg_HL.read());
-    cpu->reg_HL++;
+    cpu->regs.A = cpu->memory->read(cpu->regs.reg_HL);
+    cpu->regs.reg_HL++;
     return LD_A_mHLp_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_mhls(CPU* cpu){
-    *(cpu->A) = cpu->memory->read(cpu->reg_HL.read());  
-    cpu->reg_HL--;
+    cpu->regs.A = cpu->memory->read(cpu->regs.reg_HL);  
+    cpu->regs.reg_HL--;
     return LD_A_mHLs_CYCLES;
 }
 
 cycles LoadAndStore::ld_mhl_d8(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), (byte) cpu->parsedData);
+    cpu->memory->write(cpu->regs.reg_HL, (byte) cpu->parsedData);
     return LD_mHL_d8_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_a(CPU* cpu){
-    *(cpu->A) = *(cpu->A);
+    cpu->regs.A = cpu->regs.A;
     return LD_A_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_b(CPU* cpu){
-    *(cpu->A) = *(cpu->B);
+    cpu->regs.A = cpu->regs.B;
     return LD_A_B_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_c(CPU* cpu){
-    *(cpu->A) = *(cpu->C);
+    cpu->regs.A = cpu->regs.C;
     return LD_A_C_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_d(CPU* cpu){
-    *(cpu->A) = *(cpu->D);
+    cpu->regs.A = cpu->regs.D;
     return LD_A_D_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_e(CPU* cpu){
-    *(cpu->A) = *(cpu->E);
+    cpu->regs.A = cpu->regs.E;
     return LD_A_E_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_h(CPU* cpu){
-    *(cpu->A) = *(cpu->H);
+    cpu->regs.A = cpu->regs.H;
     return LD_A_H_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_l(CPU* cpu){
-    *(cpu->A) = *(cpu->L);
+    cpu->regs.A = cpu->regs.L;
     return LD_A_L_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_a(CPU* cpu){
-    *(cpu->B) = *(cpu->A);
+    cpu->regs.B = cpu->regs.A;
     return LD_B_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_b(CPU* cpu){
-    *(cpu->B) = *(cpu->B);
+    cpu->regs.B = cpu->regs.B;
     return LD_B_B_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_c(CPU* cpu){
-    *(cpu->B) = *(cpu->C);
+    cpu->regs.B = cpu->regs.C;
     return LD_B_C_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_d(CPU* cpu){
-    *(cpu->B) = *(cpu->D);
+    cpu->regs.B = cpu->regs.D;
     return LD_B_D_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_e(CPU* cpu){
-    *(cpu->B) = *(cpu->E);
+    cpu->regs.B = cpu->regs.E;
     return LD_B_E_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_h(CPU* cpu){
-    *(cpu->B) = *(cpu->H);
+    cpu->regs.B = cpu->regs.H;
     return LD_B_H_CYCLES;
 }
 
 cycles LoadAndStore::ld_b_l(CPU* cpu){
-    *(cpu->B) = *(cpu->L);
+    cpu->regs.B = cpu->regs.L;
     return LD_B_L_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_a(CPU* cpu){
-    *(cpu->C) = *(cpu->A);
+    cpu->regs.C = cpu->regs.A;
     return LD_C_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_b(CPU* cpu){
-    *(cpu->C) = *(cpu->B);
+    cpu->regs.C = cpu->regs.B;
     return LD_C_B_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_c(CPU* cpu){
-    *(cpu->C) = *(cpu->C);
+    cpu->regs.C = cpu->regs.C;
     return LD_C_C_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_d(CPU* cpu){
-    *(cpu->C) = *(cpu->D);
+    cpu->regs.C = cpu->regs.D;
     return LD_C_D_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_e(CPU* cpu){
-    *(cpu->C) = *(cpu->E);
+    cpu->regs.C = cpu->regs.E;
     return LD_C_E_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_h(CPU* cpu){
-    *(cpu->C) = *(cpu->H);
+    cpu->regs.C = cpu->regs.H;
     return LD_C_H_CYCLES;
 }
 
 cycles LoadAndStore::ld_c_l(CPU* cpu){
-    *(cpu->C) = *(cpu->L);
+    cpu->regs.C = cpu->regs.L;
     return LD_C_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_a(CPU* cpu){
-    *(cpu->D) = *(cpu->A);
+    cpu->regs.D = cpu->regs.A;
     return LD_D_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_b(CPU* cpu){
-    *(cpu->D) = *(cpu->B);
+    cpu->regs.D = cpu->regs.B;
     return LD_D_B_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_c(CPU* cpu){
-    *(cpu->D) = *(cpu->C);
+    cpu->regs.D = cpu->regs.C;
     return LD_D_C_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_d(CPU* cpu){
-    *(cpu->D) = *(cpu->D);
+    cpu->regs.D = cpu->regs.D;
     return LD_D_D_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_e(CPU* cpu){
-    *(cpu->D) = *(cpu->E);
+    cpu->regs.D = cpu->regs.E;
     return LD_D_E_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_h(CPU* cpu){
-    *(cpu->D) = *(cpu->H);
+    cpu->regs.D = cpu->regs.H;
     return LD_D_H_CYCLES;
 }
 
 cycles LoadAndStore::ld_d_l(CPU* cpu){
-    *(cpu->D) = *(cpu->L);
+    cpu->regs.D = cpu->regs.L;
     return LD_D_L_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_a(CPU* cpu){
-    *(cpu->E) = *(cpu->A);
+    cpu->regs.E = cpu->regs.A;
     return LD_E_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_b(CPU* cpu){
-    *(cpu->E) = *(cpu->B);
+    cpu->regs.E = cpu->regs.B;
     return LD_E_B_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_c(CPU* cpu){
-    *(cpu->E) = *(cpu->C);
+    cpu->regs.E = cpu->regs.C;
     return LD_E_C_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_d(CPU* cpu){
-    *(cpu->E) = *(cpu->D);
+    cpu->regs.E = cpu->regs.D;
     return LD_E_D_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_e(CPU* cpu){
-    *(cpu->E) = *(cpu->E);
+    cpu->regs.E = cpu->regs.E;
     return LD_E_E_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_h(CPU* cpu){
-    *(cpu->E) = *(cpu->H);
+    cpu->regs.E = cpu->regs.H;
     return LD_E_H_CYCLES;
 }
 
 cycles LoadAndStore::ld_e_l(CPU* cpu){
-    *(cpu->E) = *(cpu->L);
+    cpu->regs.E = cpu->regs.L;
     return LD_E_L_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_a(CPU* cpu){
-    *(cpu->H) = *(cpu->A);
+    cpu->regs.H = cpu->regs.A;
     return LD_H_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_b(CPU* cpu){
-    *(cpu->H) = *(cpu->B);
+    cpu->regs.H = cpu->regs.B;
     return LD_H_B_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_c(CPU* cpu){
-    *(cpu->H) = *(cpu->C);
+    cpu->regs.H = cpu->regs.C;
     return LD_H_C_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_d(CPU* cpu){
-    *(cpu->H) = *(cpu->D);
+    cpu->regs.H = cpu->regs.D;
     return LD_H_D_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_e(CPU* cpu){
-    *(cpu->H) = *(cpu->E);
+    cpu->regs.H = cpu->regs.E;
     return LD_H_E_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_h(CPU* cpu){
-    *(cpu->H) = *(cpu->H);
+    cpu->regs.H = cpu->regs.H;
     return LD_H_H_CYCLES;
 }
 
 cycles LoadAndStore::ld_h_l(CPU* cpu){
-    *(cpu->H) = *(cpu->L);
+    cpu->regs.H = cpu->regs.L;
     return LD_H_L_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_a(CPU* cpu){
-    *(cpu->L) = *(cpu->A);
+    cpu->regs.L = cpu->regs.A;
     return LD_L_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_b(CPU* cpu){
-    *(cpu->L) = *(cpu->B);
+    cpu->regs.L = cpu->regs.B;
     return LD_L_B_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_c(CPU* cpu){
-    *(cpu->L) = *(cpu->C);
+    cpu->regs.L = cpu->regs.C;
     return LD_L_C_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_d(CPU* cpu){
-    *(cpu->L) = *(cpu->D);
+    cpu->regs.L = cpu->regs.D;
     return LD_L_D_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_e(CPU* cpu){
-    *(cpu->L) = *(cpu->E);
+    cpu->regs.L = cpu->regs.E;
     return LD_L_E_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_h(CPU* cpu){
-    *(cpu->L) = *(cpu->H);
+    cpu->regs.L = cpu->regs.H;
     return LD_L_H_CYCLES;
 }
 
 cycles LoadAndStore::ld_l_l(CPU* cpu){
-    *(cpu->L) = *(cpu->L);
+    cpu->regs.L = cpu->regs.L;
     return LD_L_L_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_mhl(CPU* cpu){
-    *(cpu->A) = cpu->memory->read(cpu->reg_HL.read());
+    cpu->regs.A = cpu->memory->read(cpu->regs.reg_HL);
     return LD_A_mHL;
 }
 
 cycles LoadAndStore::ld_b_mhl(CPU* cpu){
-    *(cpu->B) = cpu->memory->read(cpu->reg_HL.read());
+    cpu->regs.B = cpu->memory->read(cpu->regs.reg_HL);
     return LD_B_mHL;
 }
 
 cycles LoadAndStore::ld_c_mhl(CPU* cpu){
-    *(cpu->C) = cpu->memory->read(cpu->reg_HL.read());
+    cpu->regs.C = cpu->memory->read(cpu->regs.reg_HL);
     return LD_C_mHL;
 }
 
 cycles LoadAndStore::ld_d_mhl(CPU* cpu){
-    *(cpu->D) = cpu->memory->read(cpu->reg_HL.read());
+    cpu->regs.D = cpu->memory->read(cpu->regs.reg_HL);
     return LD_D_mHL;
 }
 
 cycles LoadAndStore::ld_e_mhl(CPU* cpu){
-    *(cpu->E) = cpu->memory->read(cpu->reg_HL.read());
+    cpu->regs.E = cpu->memory->read(cpu->regs.reg_HL);
     return LD_E_mHL;
 }
 
 cycles LoadAndStore::ld_h_mhl(CPU* cpu){
-    *(cpu->H) = cpu->memory->read(cpu->reg_HL.read());
+    cpu->regs.H = cpu->memory->read(cpu->regs.reg_HL);
     return LD_H_mHL;
 }
 
 cycles LoadAndStore::ld_l_mhl(CPU* cpu){
-    *(cpu->L) = cpu->memory->read(cpu->reg_HL.read());
+    cpu->regs.L = cpu->memory->read(cpu->regs.reg_HL);
     return LD_L_mHL;
 }
 
 cycles LoadAndStore::ld_mhl_a(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->A));
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.A);
     return LD_mHL_A;
 }
 
 cycles LoadAndStore::ld_mhl_b(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->B));
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.B);
     return LD_mHL_B;
 }
 
 cycles LoadAndStore::ld_mhl_c(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->C));
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.C);
     return LD_mHL_C;
 }
 
 cycles LoadAndStore::ld_mhl_d(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->D));
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.D);
     return LD_mHL_D;
 }
 
 cycles LoadAndStore::ld_mhl_e(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->E));
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.E);
     return LD_mHL_E;
 }
 
 cycles LoadAndStore::ld_mhl_h(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->H));
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.H);
     return LD_mHL_H;
 }
 
 cycles LoadAndStore::ld_mhl_l(CPU* cpu){
-    cpu->memory->write(cpu->reg_HL.read(), *(cpu->L));
+    cpu->memory->write(cpu->regs.reg_HL, cpu->regs.L);
     return LD_mHL_L;
 }
 
 cycles LoadAndStore::pop_bc(CPU* cpu){
-    popHelper(cpu, cpu->reg_BC);
+    popHelper(cpu, cpu->regs.reg_BC);
 
     return POP_BC_CYCLES;
 }
 
 cycles LoadAndStore::pop_de(CPU* cpu){
-    popHelper(cpu, cpu->reg_DE);
+    popHelper(cpu, cpu->regs.reg_DE);
 
     return POP_DE_CYCLES;
 }
 
 cycles LoadAndStore::pop_hl(CPU* cpu){
-    popHelper(cpu, cpu->reg_HL);
+    popHelper(cpu, cpu->regs.reg_HL);
 
     return POP_HL_CYCLES;
 }
 
 cycles LoadAndStore::pop_af(CPU* cpu){
-    popHelper(cpu, cpu->reg_AF);
+    cpu->materializeFlags();
+    popHelper(cpu, cpu->regs.reg_AF);
+    // The lower 4 bits of F always read as zero.
+    cpu->regs.F &= 0xF0;
 
     return POP_AF_CYCLES;
 }
     
 cycles LoadAndStore::push_bc(CPU* cpu){
-    pushHelper(cpu, cpu->reg_BC);
+    pushHelper(cpu, cpu->regs.reg_BC);
 
     return PUSH_BC_CYCLES;
 }
 
 cycles LoadAndStore::push_de(CPU* cpu){
-    pushHelper(cpu, cpu->reg_DE);
+    pushHelper(cpu, cpu->regs.reg_DE);
 
     return PUSH_DE_CYCLES;
 }
 
 cycles LoadAndStore::push_hl(CPU* cpu){
-    pushHelper(cpu, cpu->reg_HL);
+    pushHelper(cpu, cpu->regs.reg_HL);
 
     return PUSH_HL_CYCLES;
 }
 
 cycles LoadAndStore::push_af(CPU* cpu){
-    pushHelper(cpu, cpu->reg_AF);
+    cpu->materializeFlags();
+    pushHelper(cpu, cpu->regs.reg_AF);
 
     return PUSH_AF_CYCLES;
 }
 
 cycles LoadAndStore::ld_ma16_a(CPU* cpu){
-    cpu->memory->write(cpu->parsedData, *(cpu->A));
+    cpu->memory->write(cpu->parsedData, cpu->regs.A);
 
     return LD_ma16_A_CYCLES;
 }
 
 cycles LoadAndStore::ld_a_ma16(CPU* cpu){
-    *(cpu->A) = cpu->memory->read(cpu->parsedData);
+    cpu->regs.A = cpu->memory->read(cpu->parsedData);
 
     return LD_A_ma16_CYCLES;
 }
 
 cycles LoadAndStore::ld_hl_sp_pp8(CPU* cpu){
+    cpu->materializeFlags();
 
     signedByte imm8 = cpu->parsedData;
-    word result = (cpu->SP.read() + imm8);
+    word result = (cpu->regs.SP + imm8);
 
-    writeBit(*(cpu->F), FLAG_Z, 0);
-    writeBit(*(cpu->F), FLAG_N, 0);
-    writeBit(*(cpu->F), FLAG_C, (( cpu->SP.read() & 0xFF) + (imm8 & 0xFF)) > 0xFF);
-    writeBit(*(cpu->F), FLAG_H, (((cpu->SP.read() & 0xF ) + (imm8 & 0xF )) > 0xF));
+    writeBit(cpu->regs.F, FLAG_Z, 0);
+    writeBit(cpu->regs.F, FLAG_N, 0);
+    writeBit(cpu->regs.F, FLAG_C, (( cpu->regs.SP & 0xFF) + (imm8 & 0xFF)) > 0xFF);
+    writeBit(cpu->regs.F, FLAG_H, (((cpu->regs.SP & 0xF ) + (imm8 & 0xF )) > 0xF));
 
-    cpu->reg_HL = result;
+    cpu->regs.reg_HL = result;
 
     return LD_HL_SPpr8_CYCLES;
 }
 
 cycles LoadAndStore::ld_sp_hl(CPU* cpu){
 
-    cpu->SP = cpu->reg_HL.read();
+    cpu->regs.SP = cpu->regs.reg_HL;
 
     return LD_SP_HL_CYCLES;
 }
\ No newline at end of file
@@ -6,13 +6,15 @@
 #include "include/memory.h"
 #include "include/ppu.h"
 #include <functional>
+#include <algorithm>
 
 // todo!!! turn off GBC regs if we are not running in GBC mode.
 
-void IOController::init(CPU* d_cpu, PPU* d_ppu, APU* d_apu){
+void IOController::init(CPU* d_cpu, PPU* d_ppu, APU* d_apu, Scheduler* d_scheduler){
     cpu = d_cpu;
     ppu = d_ppu;
     apu = d_apu;
+    scheduler = d_scheduler;
 
     reset();
 }
@@ -28,10 +30,11 @@ void IOController::reset(){
     IF = 0xFF;
     KEY1SwitchArmed = false;
     // Init timers.
-    TIMATimer.resetTimer(0);
-    DIVTimer.resetTimer(0);
-    DIVTimer.setIncrementFrequency( 256);
-    DIVTimer.setRunning(true);
+    uint64_t now = scheduler->getNow();
+    setTimersDoubleSpeed(now, false);
+    TIMATimer.resetTimer(now, 0);
+    systemCounter = 0;
+    systemCounterUpdatedAt = now;
     divAPUCounter = 0;
     
     joypad.reset();
@@ -40,19 +43,43 @@ void IOController::reset(){
 }
 
 void IOController::cycle(bool cpuDoubleSpeed){
+    uint64_t now = scheduler->getNow();
+    // The CPU switched speed this cycle.
+    if(cpuDoubleSpeed != timersDoubleSpeed) setTimersDoubleSpeed(now, cpuDoubleSpeed);
 
-    // Cycle the div timer and track “DIV-APU” counter events.
-    bool divBitBefore = cpuDoubleSpeed ? readBit(DIVTimer.read(), 5) : readBit(DIVTimer.read(), 4);
-    DIVTimer.cycle(cpuDoubleSpeed);
-    bool divBitAfter = cpuDoubleSpeed ? readBit(DIVTimer.read(), 5) : readBit(DIVTimer.read(), 4);
-    // If bit 4 (5 in double-speed mode) goes from 1 to 0, inc divAPUCounter. 
-    if( divBitBefore && !divBitAfter) divAPUCounter++;
+    // If bit 4 of DIV (5 in double-speed mode) goes from 1 to 0, inc divAPUCounter. 
+    word divAPUBit = cpuDoubleSpeed ? 1 << 13 : 1 << 12;
+    if((getSystemCounter(now) & divAPUBit) && !(getSystemCounter(now + 1) & divAPUBit)) divAPUCounter++;
 
-    TIMATimer.cycle(cpuDoubleSpeed, std::bind(&IOController::TIMATimerOverflowLogic, this));
+    if(TIMATimer.cycle(now, TMA)) TIMATimerOverflowLogic();
 
     dmaController.cycle(cpuDoubleSpeed);
 }
 
+cycles IOController::cyclesUntilEvent(bool cpuDoubleSpeed){
+    // The DMA copies at its own pace, leave it to `cycle`.
+    if(dmaController.isTransferActive()) return 0;
+
+    uint64_t now = scheduler->getNow();
+    cycles increment = cpuDoubleSpeed ? 2 : 1;
+    // The next falling edge of DIV bit 4 (5 in double-speed mode), when the
+    // bits below and including it next wrap around.
+    uint32_t divAPUPeriod = cpuDoubleSpeed ? 1 << 14 : 1 << 13;
+    uint32_t countsUntilDivEvent = divAPUPeriod - (getSystemCounter(now) & (divAPUPeriod - 1));
+    cycles untilDivEvent = (countsUntilDivEvent + increment - 1) / increment - 1;
+    // The next TIMA overflow.
+    cycles untilOverflow = TIMATimer.cyclesUntilOverflow(now);
+
+    return std::min(untilDivEvent, untilOverflow);
+}
+
+void IOController::setTimersDoubleSpeed(uint64_t now, bool state){
+    systemCounter = getSystemCounter(now);
+    systemCounterUpdatedAt = now;
+    timersDoubleSpeed = state;
+    TIMATimer.setDoubleSpeed(now, state);
+}
+
 void IOController::bindMemory(Memory* d_memory){
     memory = d_memory;
     dmaController.bindMemory(d_memory);
@@ -63,8 +90,7 @@ void IOController::bindMemory(Memory* d_memory){
 }
 
 void IOController::TIMATimerOverflowLogic(){
-    // Populate the timer with the TMA-Timer modulo value.
-    TIMATimer.resetTimer(memory->read(0xFF06));
+    // The timer has already been reloaded with the TMA-Timer modulo value.
     // Raise a timer interrupt by setting bit two of the IF register.
     byte value = memory->read(INTERRUPT_FLAG_REGISTER_ADDR);
     writeBit(value, 2, true);
@@ -82,10 +108,10 @@ byte IOController::read(word address){
             return joypad.read();
         // DIV: Divider register.
         case 0xFF04:
-            return DIVTimer.read();
+            return getSystemCounter(scheduler->getNow()) >> 8;
         // TIMA: Timer counter.
         case 0xFF05:
-           return TIMATimer.read();
+           return TIMATimer.read(scheduler->getNow());
          // TMA: Timer modulo.
         case 0xFF06:
             return TMA;
@@ -211,6 +237,11 @@ byte IOController::read(word address){
     }
 }
 void IOController::write(word address, byte data){
+    // The PPU idles between its events, catch it up before anything it reads
+    // changes. Its own registers only change on those events, which always
+    // run on time, so reads leave it be.
+    if(address == INTERRUPT_FLAG_REGISTER_ADDR || (address >= 0xFF40 && address <= 0xFF4B) || (address >= 0xFF68 && address <= 0xFF6B))
+        ppu->registerWritten();
     // Special case for wave pattern RAM.
     if(address >= WAVEPATTERNRAME_START && address <= WAVEPATTERNRAME_END)
         return apu->writeRAM(address, data);
@@ -222,11 +253,12 @@ void IOController::write(word address, byte data){
             break;
         // DIV: Divider register.
         case 0xFF04:
-            DIVTimer.resetTimer(0);
+            systemCounter = 0;
+            systemCounterUpdatedAt = scheduler->getNow();
             break;
         // TIMA: Timer counter.
         case 0xFF05:
-           TIMATimer.resetTimer(0);
+           TIMATimer.resetTimer(scheduler->getNow(), 0);
            break;
          // TMA: Timer modulo.
         case 0xFF06:
@@ -237,7 +269,7 @@ void IOController::write(word address, byte data){
             TAC = data | 0b11111000;
             // Bit 2 defines the timer enable.
             bool enable = (TAC & 0b100) >> 2;
-            TIMATimer.setRunning(enable);
+            TIMATimer.setRunning(scheduler->getNow(), enable);
 
             // Lower 2 bits define which factor to divide the CPU clock speed.
             byte speedIndex = (TAC & 0b11);
@@ -259,7 +291,7 @@ void IOController::write(word address, byte data){
                     break;
                 }
 
-            TIMATimer.setIncrementFrequency(clockSpeedFactor); 
+            TIMATimer.setIncrementFrequency(scheduler->getNow(), clockSpeedFactor); 
             break;}
         // IF - Interrupt Flag
         case 0xFF0F:
@@ -473,7 +505,18 @@ void IOController::saveToState(std::ofstream & stateFile){
     // Timers.
     std::memcpy(writeBuffer, &TMA, sizeof(byte)); writeBuffer+=sizeof(byte);
     std::memcpy(writeBuffer, &TAC, sizeof(byte)); writeBuffer+=sizeof(byte);
-    DIVTimer.saveToState(writeBuffer);
+    // DIV is saved the same way as a timer dividing the clock by 256.
+    uint64_t now = scheduler->getNow();
+    word counter = getSystemCounter(now);
+    byte div = counter >> 8;
+    cycles divClockSpeed = 256;
+    cycles divCyclesPassed = counter & 0xFF;
+    bool divRunning = true;
+    std::memcpy(writeBuffer, &div, sizeof(byte)); writeBuffer+=sizeof(byte);
+    std::memcpy(writeBuffer, &divClockSpeed, sizeof(cycles)); writeBuffer+=sizeof(cycles);
+    std::memcpy(writeBuffer, &divCyclesPassed, sizeof(cycles)); writeBuffer+=sizeof(cycles);
+    std::memcpy(writeBuffer, &divRunning, sizeof(bool)); writeBuffer+=sizeof(bool);
+    TIMATimer.update(now);
     TIMATimer.saveToState(writeBuffer);
     std::memcpy(writeBuffer, &divAPUCounter, sizeof(byte)); writeBuffer+=sizeof(byte);
     // Palettes.
@@ -510,8 +553,19 @@ void IOController::loadFromState(std::ifstream & stateFile){
     // Timers.
     std::memcpy(&TMA, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
     std::memcpy(&TAC, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
-    DIVTimer.loadFromState(readBuffer);
-    TIMATimer.loadFromState(readBuffer);
+    uint64_t now = scheduler->getNow();
+    byte div = 0;
+    cycles divCyclesPassed = 0;
+    std::memcpy(&div, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
+    readBuffer+=sizeof(cycles); // DIV's clock speed is always 256.
+    std::memcpy(&divCyclesPassed, readBuffer, sizeof(cycles)); readBuffer+=sizeof(cycles);
+    readBuffer+=sizeof(bool); // DIV always runs.
+    systemCounter = (div << 8) | (divCyclesPassed & 0xFF);
+    systemCounterUpdatedAt = now;
+    TIMATimer.loadFromState(readBuffer, now);
+    // The CPU's state, and with it its speed, is loaded first.
+    timersDoubleSpeed = cpu->getDoubleSpeedMode();
+    TIMATimer.setDoubleSpeed(now, timersDoubleSpeed);
     std::memcpy(&divAPUCounter, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
 
     // Palettes.
@@ -0,0 +1,521 @@
+/**
+ * JIT class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\jit.h"
+#include "include\cpu.h"
+#include <cstring>
+#include <cstddef>
+
+#ifdef JIT_SUPPORTED
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#endif
+
+bool JIT::isCompilable(const DecodedInstruction& instruction){
+    switch (instruction.opcode)
+    {
+    case HALT: case STOP: case EI: case DI:
+    case UNDEF_D3: case UNDEF_DB: case UNDEF_DD: case UNDEF_E3: case UNDEF_E4: case UNDEF_EB:
+    case UNDEF_EC: case UNDEF_ED: case UNDEF_F4: case UNDEF_FC: case UNDEF_FD:
+    // Accesses to FF00-FFFF.
+    case LDH_ma8_A: case LDH_A_ma8: case LD_mC_A: case LD_A_mC:
+        return false;
+    case LD_ma16_A: case LD_A_ma16: case LD_mA16_SP:
+        return instruction.parsedData < IOPORTS_START;
+    default:
+        return true;
+    }
+}
+
+int JIT::getRegisterAccess(const DecodedInstruction& instruction){
+    switch (instruction.opcode)
+    {
+    case LD_A_mBC: case LD_A_mDE: case LD_A_mHLp: case LD_A_mHLs:
+    case LD_B_mHL: case LD_C_mHL: case LD_D_mHL: case LD_E_mHL: case LD_H_mHL: case LD_L_mHL: case LD_A_mHL:
+    case ADD_A_mHL: case ADC_A_mHL: case SUB_mHL: case SBC_A_mHL:
+    case AND_mHL: case XOR_mHL: case OR_mHL: case CP_mHL:
+        return JIT_ACCESS_READ;
+    case LD_mBC_A: case LD_mDE_A: case LD_mHLp_A: case LD_mHLs_A: case LD_mHL_d8:
+    case LD_mHL_B: case LD_mHL_C: case LD_mHL_D: case LD_mHL_E: case LD_mHL_H: case LD_mHL_L: case LD_mHL_A:
+        return JIT_ACCESS_WRITE;
+    case INC_mHL: case DEC_mHL:
+        return JIT_ACCESS_READ_WRITE;
+    case PREFIX_CB:
+        // The (HL) forms of the CB instructions, BIT only reads.
+        if((instruction.parsedData & 0x07) != 0x06) return JIT_ACCESS_NONE;
+        return (instruction.parsedData & 0xC0) == 0x40 ? JIT_ACCESS_READ : JIT_ACCESS_READ_WRITE;
+    default:
+        return JIT_ACCESS_NONE;
+    }
+}
+
+bool JIT::endsBlock(const DecodedInstruction& instruction){
+    if(DecodeCache::endsBasicBlock(instruction.opcode) || !isCompilable(instruction)) return true;
+    // A guarded access may have to exit the block, see `compile`.
+    if(getRegisterAccess(instruction) != JIT_ACCESS_NONE) return true;
+    // A store into ROM may switch the mapped bank under the rest of the block.
+    switch (instruction.opcode)
+    {
+    case LD_ma16_A: case LD_mA16_SP:
+        return instruction.parsedData <= ROMBANKN_END;
+    default:
+        return false;
+    }
+}
+
+bool JIT::handlerReadsPC(byte opcode){
+    switch (opcode)
+    {
+    case JR_r8: case JR_NZ_r8: case JR_Z_r8: case JR_NC_r8: case JR_C_r8:
+    case JP_a16: case JP_NZ_a16: case JP_Z_a16: case JP_NC_a16: case JP_C_a16: case JP_HL:
+    case CALL_a16: case CALL_NZ_a16: case CALL_Z_a16: case CALL_NC_a16: case CALL_C_a16:
+    case RET: case RET_NZ: case RET_Z: case RET_NC: case RET_C: case RETI:
+    case RST_00H: case RST_08H: case RST_10H: case RST_18H:
+    case RST_20H: case RST_28H: case RST_30H: case RST_38H:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void JIT::materializeFlags(CPU* cpu){
+    cpu->materializeFlags();
+}
+
+#ifdef JIT_SUPPORTED
+// x86-64 encodings.
+static void emitBytes(std::vector<byte>& code, std::initializer_list<byte> bytes){
+    code.insert(code.end(), bytes);
+}
+static void emitImmediate(std::vector<byte>& code, uint64_t value, int size){
+    for(int i = 0; i < size; i++) code.push_back((value >> (8*i)) & 0xFF);
+}
+// mov rax, imm64
+static void emitMovRax(std::vector<byte>& code, const void* value){
+    emitBytes(code, {0x48, 0xB8});
+    emitImmediate(code, (uint64_t)value, 8);
+}
+// mov word [imm64], imm16
+static void emitStoreWord(std::vector<byte>& code, const void* address, word value){
+    emitMovRax(code, address);
+    emitBytes(code, {0x66, 0xC7, 0x00});
+    emitImmediate(code, value, 2);
+}
+// First argument register, then call rax.
+static void emitCall(std::vector<byte>& code, CPU* cpu, const void* function){
+#ifdef _WIN32
+    emitBytes(code, {0x48, 0xB9}); // mov rcx, imm64
+#else
+    emitBytes(code, {0x48, 0xBF}); // mov rdi, imm64
+#endif
+    emitImmediate(code, (uint64_t)cpu, 8);
+    emitMovRax(code, function);
+    emitBytes(code, {0xFF, 0xD0});
+}
+// Stack adjustment after pushing rbx, keeping rsp 16 byte aligned at every
+// call. Windows also needs the shadow space.
+#ifdef _WIN32
+#define JIT_STACK_ADJUST 0x20
+#else
+#define JIT_STACK_ADJUST 0x00
+#endif
+
+// add rsp, imm8; pop rbx; ret
+static void emitEpilogue(std::vector<byte>& code){
+    if(JIT_STACK_ADJUST) emitBytes(code, {0x48, 0x83, 0xC4, JIT_STACK_ADJUST});
+    emitBytes(code, {0x5B, 0xC3});
+}
+
+// Blocks keep a pointer to the CPU's registers in rbx, which handlers
+// preserve. These are the offsets of the registers from it.
+static const byte NO_REGISTER = 0xFF;
+// The 8 bit registers as the opcodes number them, 6 is (HL).
+static const byte REGISTER_OFFSETS[8] = {
+    offsetof(CPU_State, B), offsetof(CPU_State, C), offsetof(CPU_State, D), offsetof(CPU_State, E),
+    offsetof(CPU_State, H), offsetof(CPU_State, L), NO_REGISTER, offsetof(CPU_State, A)
+};
+// The 16 bit registers of INC rr, DEC rr and LD rr,d16.
+static const byte REGISTER_PAIR_OFFSETS[4] = {
+    offsetof(CPU_State, reg_BC), offsetof(CPU_State, reg_DE), offsetof(CPU_State, reg_HL), offsetof(CPU_State, SP)
+};
+static const byte A_OFFSET = offsetof(CPU_State, A);
+static const byte F_OFFSET = offsetof(CPU_State, F);
+static const byte HL_OFFSET = offsetof(CPU_State, reg_HL);
+static const byte PC_OFFSET = offsetof(CPU_State, PC);
+
+// The bits of F.
+static const byte Z = 1 << FLAG_Z;
+static const byte N = 1 << FLAG_N;
+static const byte H = 1 << FLAG_H;
+static const byte C = 1 << FLAG_C;
+
+// The x86 ALU operations on al with an r/m8 operand, in the order of the
+// 8 bit ALU opcodes: ADD, ADC, SUB, SBC, AND, XOR, OR and CP. The forms
+// taking an imm8 follow each of them.
+static const byte ALU_OPCODES[8] = {0x02, 0x12, 0x2A, 0x1A, 0x22, 0x32, 0x0A, 0x3A};
+
+// `opcode` with a [rbx+offset] operand, `reg` is the ModRM reg field.
+static void emitRegisterOperand(std::vector<byte>& code, std::initializer_list<byte> opcode, byte reg, byte offset){
+    emitBytes(code, opcode);
+    emitBytes(code, {(byte)(0x43 | (reg << 3)), offset});
+}
+// mov word [rbx+offset], imm16
+static void emitStoreRegisterPair(std::vector<byte>& code, byte offset, word value){
+    emitRegisterOperand(code, {0x66, 0xC7}, 0, offset);
+    emitImmediate(code, value, 2);
+}
+
+// Writes the host's flags from the last operation to F. lahf loads CF, AF 
+// and ZF into bits 0, 4 and 6 of ah, which are C, H and Z on the GameBoy:
+// x86 computes the half carry of every 8 bit operation the same way. Only
+// `hostFlags` are taken from the host, `setFlags` are set on top and C is
+// kept from F if `keepCarry` is set.
+static void emitStoreFlags(std::vector<byte>& code, byte hostFlags, byte setFlags, bool keepCarry){
+    emitBytes(code, {0x9F, 0x88, 0xE0, 0x24, 0x50, 0x00, 0xC0}); // lahf; mov al, ah; and al, 0x50; add al, al
+    if(hostFlags & C) emitBytes(code, {0x80, 0xE4, 0x01, 0xC0, 0xE4, 0x04, 0x08, 0xE0}); // and ah, 1; shl ah, 4; or al, ah
+    emitBytes(code, {0x24, hostFlags}); // and al, hostFlags
+    if(setFlags) emitBytes(code, {0x0C, setFlags}); // or al, setFlags
+    if(keepCarry){
+        emitRegisterOperand(code, {0x8A}, 2, F_OFFSET); // mov dl, [F]
+        emitBytes(code, {0x80, 0xE2, C, 0x08, 0xD0}); // and dl, C; or al, dl
+    }
+    emitRegisterOperand(code, {0x88}, 0, F_OFFSET); // mov [F], al
+}
+
+// Sets PC to `target` if `condition` (NZ, Z, NC or C as the opcodes number
+// them) holds, otherwise to `nextPC`.
+static void emitBranch(std::vector<byte>& code, byte condition, word target, word nextPC){
+    emitRegisterOperand(code, {0xF6}, 0, F_OFFSET); // test byte [F], imm8
+    emitBytes(code, {condition < 2 ? Z : C});
+    emitStoreRegisterPair(code, PC_OFFSET, nextPC);
+    // Skip the store of the target if the condition fails: the flag is set for NZ and NC, clear for Z and C.
+    emitBytes(code, {(byte)(condition & 1 ? 0x74 : 0x75), 0x06}); // jz/jnz over the next store
+    emitStoreRegisterPair(code, PC_OFFSET, target);
+}
+
+// Exits the block before the instruction at `pc` unless the page
+// `pageRegister` points into is mapped in `pageTable`. The instruction's
+// cycles are left banked for the interpreter to run it, see `CPU::cycle`.
+static void emitPageGuard(std::vector<byte>& code, const void* pageTable, byte pageRegister, word pc, cycles* banked, cycles instructionCycles){
+    emitRegisterOperand(code, {0x0F, 0xB6}, 0, pageRegister); // movzx eax, byte [pageRegister]
+    emitBytes(code, {0x48, 0xB9}); // mov rcx, imm64
+    emitImmediate(code, (uint64_t)pageTable, 8);
+    emitBytes(code, {0x48, 0x83, 0x3C, 0xC1, 0x00}); // cmp qword [rcx+rax*8], 0
+
+    std::vector<byte> exit;
+    emitStoreRegisterPair(exit, PC_OFFSET, pc);
+    emitMovRax(exit, banked);
+    emitBytes(exit, {0xC7, 0x00}); // mov dword [rax], imm32
+    emitImmediate(exit, instructionCycles, 4);
+    emitEpilogue(exit);
+
+    emitBytes(code, {0x75, (byte)exit.size()}); // jne over the exit
+    code.insert(code.end(), exit.begin(), exit.end());
+}
+
+/**
+ * @brief Emits `decoded` as x86 on the registers, if it is one the JIT does
+ * without its handler. Returns false if the handler has to be called.
+ * `touchesFlags` is set if the code reads or writes F, `setsPC` if it ends
+ * the block by setting PC.
+ */
+static bool emitInline(std::vector<byte>& code, const DecodedInstruction& decoded, word nextPC, bool& touchesFlags, bool& setsPC){
+    byte opcode = decoded.opcode;
+    touchesFlags = false;
+    setsPC = false;
+
+    if(opcode == NOP) return true;
+
+    // LD r,r'
+    if(opcode >= 0x40 && opcode <= 0x7F && opcode != HALT){
+        byte destination = REGISTER_OFFSETS[(opcode >> 3) & 7];
+        byte source = REGISTER_OFFSETS[opcode & 7];
+        if(destination == NO_REGISTER || source == NO_REGISTER) return false;
+        emitRegisterOperand(code, {0x8A}, 0, source); // mov al, [source]
+        emitRegisterOperand(code, {0x88}, 0, destination); // mov [destination], al
+        return true;
+    }
+
+    // ALU A,r and ALU A,d8
+    if((opcode >= 0x80 && opcode <= 0xBF) || (opcode >= 0xC0 && (opcode & 0x07) == 0x06)){
+        byte operation = (opcode >> 3) & 7;
+        if(opcode < 0xC0 && REGISTER_OFFSETS[opcode & 7] == NO_REGISTER) return false;
+        emitRegisterOperand(code, {0x8A}, 0, A_OFFSET); // mov al, [A]
+        // ADC and SBC shift the carry flag into the host's.
+        if(operation == 1 || operation == 3){
+            emitRegisterOperand(code, {0x8A}, 2, F_OFFSET); // mov dl, [F]
+            emitBytes(code, {0xC0, 0xEA, FLAG_C + 1}); // shr dl, 5
+        }
+        if(opcode < 0xC0) emitRegisterOperand(code, {ALU_OPCODES[operation]}, 0, REGISTER_OFFSETS[opcode & 7]);
+        else emitBytes(code, {(byte)(ALU_OPCODES[operation] + 2), (byte)decoded.parsedData});
+        // CP only sets the flags.
+        if(operation != 7) emitRegisterOperand(code, {0x88}, 0, A_OFFSET); // mov [A], al
+        switch (operation)
+        {
+        case 0: case 1: emitStoreFlags(code, Z | H | C, 0, false); break;
+        case 2: case 3: case 7: emitStoreFlags(code, Z | H | C, N, false); break;
+        case 4: emitStoreFlags(code, Z, H, false); break;
+        default: emitStoreFlags(code, Z, 0, false); break;
+        }
+        touchesFlags = true;
+        return true;
+    }
+
+    if(opcode < 0x40){
+        byte reg = REGISTER_OFFSETS[(opcode >> 3) & 7];
+        byte pair = REGISTER_PAIR_OFFSETS[opcode >> 4];
+        switch (opcode & 0x0F)
+        {
+        // INC r, DEC r and LD r,d8
+        case 0x04: case 0x0C:
+            if(reg == NO_REGISTER) return false;
+            emitRegisterOperand(code, {0xFE}, 0, reg); // inc byte [reg]
+            emitStoreFlags(code, Z | H, 0, true);
+            touchesFlags = true;
+            return true;
+        case 0x05: case 0x0D:
+            if(reg == NO_REGISTER) return false;
+            emitRegisterOperand(code, {0xFE}, 1, reg); // dec byte [reg]
+            emitStoreFlags(code, Z | H, N, true);
+            touchesFlags = true;
+            return true;
+        case 0x06: case 0x0E:
+            if(reg == NO_REGISTER) return false;
+            emitRegisterOperand(code, {0xC6}, 0, reg); // mov byte [reg], imm8
+            emitBytes(code, {(byte)decoded.parsedData});
+            return true;
+        // LD rr,d16, INC rr and DEC rr
+        case 0x01:
+            emitStoreRegisterPair(code, pair, decoded.parsedData);
+            return true;
+        case 0x03:
+            emitRegisterOperand(code, {0x66, 0xFF}, 0, pair); // inc word [pair]
+            return true;
+        case 0x0B:
+            emitRegisterOperand(code, {0x66, 0xFF}, 1, pair); // dec word [pair]
+            return true;
+        default:
+            break;
+        }
+    }
+
+    // JR r8, JR cc,r8, JP a16, JP cc,a16 and JP HL
+    switch (opcode)
+    {
+    case JR_r8:
+        emitStoreRegisterPair(code, PC_OFFSET, nextPC + (int8_t)decoded.parsedData);
+        break;
+    case JR_NZ_r8: case JR_Z_r8: case JR_NC_r8: case JR_C_r8:
+        emitBranch(code, (opcode >> 3) & 3, nextPC + (int8_t)decoded.parsedData, nextPC);
+        touchesFlags = true;
+        break;
+    case JP_a16:
+        emitStoreRegisterPair(code, PC_OFFSET, decoded.parsedData);
+        break;
+    case JP_NZ_a16: case JP_Z_a16: case JP_NC_a16: case JP_C_a16:
+        emitBranch(code, (opcode >> 3) & 3, decoded.parsedData, nextPC);
+        touchesFlags = true;
+        break;
+    case JP_HL:
+        emitRegisterOperand(code, {0x66, 0x8B}, 0, HL_OFFSET); // mov ax, [HL]
+        emitRegisterOperand(code, {0x66, 0x89}, 0, PC_OFFSET); // mov [PC], ax
+        break;
+    default:
+        return false;
+    }
+    setsPC = true;
+    return true;
+}
+
+// Flips the arena between writable and executable, it is never both.
+static bool protectArena(byte* arena, bool writable){
+#ifdef _WIN32
+    DWORD oldProtection;
+    return VirtualProtect(arena, JIT_ARENA_SIZE, writable ? PAGE_READWRITE : PAGE_EXECUTE_READ, &oldProtection) != 0;
+#else
+    return mprotect(arena, JIT_ARENA_SIZE, writable ? (PROT_READ | PROT_WRITE) : (PROT_READ | PROT_EXEC)) == 0;
+#endif
+}
+#endif
+
+JIT::~JIT(){
+    clear();
+#ifdef JIT_SUPPORTED
+    if(arena){
+#ifdef _WIN32
+        VirtualFree(arena, 0, MEM_RELEASE);
+#else
+        munmap(arena, JIT_ARENA_SIZE);
+#endif
+    }
+#endif
+}
+
+void JIT::clear(){
+    for(JITBlock* bankTable : banks) delete[] bankTable;
+    banks.clear();
+    arenaUsed = 0;
+    installedBlocks = false;
+}
+
+void JIT::flushArena(){
+    // Drop every block compiled into the arena, installed blocks live elsewhere.
+    for(JITBlock* bankTable : banks){
+        if(bankTable == nullptr) continue;
+        for(int i = 0; i < ROM_BANK_SIZE; i++){
+            byte* code = (byte*)bankTable[i].code;
+            if(code >= arena && code < arena + JIT_ARENA_SIZE) bankTable[i] = {};
+        }
+    }
+    arenaUsed = 0;
+}
+
+void JIT::installBlock(word bank, word address, compiledBlock code, cycles cycleCount){
+    JITBlock& block = getEntry(bank, address);
+    block.code = code;
+    block.cycleCount = cycleCount;
+    installedBlocks = true;
+}
+
+JITBlock& JIT::getEntry(word bank, word address){
+    if(bank >= banks.size()) banks.resize(bank + 1, nullptr);
+    JITBlock*& bankTable = banks[bank];
+    if(bankTable == nullptr) bankTable = new JITBlock[ROM_BANK_SIZE]();
+    return bankTable[address & (ROM_BANK_SIZE - 1)];
+}
+
+const JITBlock* JIT::lookup(Memory* memory, word address){
+    if(!DecodeCache::isCacheable(address)) return nullptr;
+    word bank = memory->getMappedROMBank(address);
+    if(bank >= banks.size() || banks[bank] == nullptr) return nullptr;
+    const JITBlock* block = &banks[bank][address & (ROM_BANK_SIZE - 1)];
+    return block->code ? block : nullptr;
+}
+
+void JIT::recordBlockStart(CPU* cpu, word address){
+#ifdef JIT_SUPPORTED
+    if(!DecodeCache::isCacheable(address)) return;
+    JITBlock& block = getEntry(cpu->memory->getMappedROMBank(address), address);
+    if(block.code || block.rejected) return;
+    if(++block.hits >= JIT_HOT_THRESHOLD) compile(cpu, address, block);
+#endif
+}
+
+void JIT::compile(CPU* cpu, word address, JITBlock& block){
+#ifdef JIT_SUPPORTED
+    // Lazily reserve the arena. It is only made executable once code is written.
+    if(arena == nullptr){
+#ifdef _WIN32
+        arena = (byte*)VirtualAlloc(nullptr, JIT_ARENA_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+        void* mapping = mmap(nullptr, JIT_ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        arena = mapping == MAP_FAILED ? nullptr : (byte*)mapping;
+#endif
+        if(arena == nullptr){
+            std::cerr << "ERROR: Could not allocate executable memory, JIT disabled!" << std::endl;
+            block.rejected = true;
+            return;
+        }
+    }
+
+    std::vector<byte> code;
+    // push rbx; sub rsp, imm8; mov rbx, imm64
+    emitBytes(code, {0x53});
+    if(JIT_STACK_ADJUST) emitBytes(code, {0x48, 0x83, 0xEC, JIT_STACK_ADJUST});
+    emitBytes(code, {0x48, 0xBB});
+    emitImmediate(code, (uint64_t)&cpu->regs, 8);
+
+    // A call to `materializeFlags` if an operation's flags are still pending:
+    // mov rax, imm64; cmp byte [rax], LAZY_FLAGS_NONE; je over the call
+    std::vector<byte> materialize;
+    emitCall(materialize, cpu, (const void*)&JIT::materializeFlags);
+    std::vector<byte> materializeIfPending;
+    emitMovRax(materializeIfPending, &cpu->lazyFlags.operation);
+    emitBytes(materializeIfPending, {0x80, 0x38, LAZY_FLAGS_NONE, 0x74, (byte)materialize.size()});
+    materializeIfPending.insert(materializeIfPending.end(), materialize.begin(), materialize.end());
+
+    word pc = address;
+    cycles blockCycles = 0;
+    // The interpreter and handlers may leave flags pending, the emitted code
+    // works on F itself.
+    bool flagsPending = true;
+    bool setsPC = false;
+    for(int count = 0; count < JIT_MAX_BLOCK_INSTRUCTIONS; count++){
+        // Stay inside the region, the other one may be remapped independently.
+        if((pc & 0xC000) != (address & 0xC000)) break;
+        const DecodedInstruction* decoded = cpu->decodeCache.lookup(cpu->memory, pc);
+        if(decoded == nullptr || !isCompilable(*decoded)) break;
+        pc += decoded->length;
+
+        std::vector<byte> instruction;
+        bool touchesFlags;
+        if(emitInline(instruction, *decoded, pc, touchesFlags, setsPC)){
+            if(touchesFlags && flagsPending) code.insert(code.end(), materializeIfPending.begin(), materializeIfPending.end());
+            if(touchesFlags) flagsPending = false;
+            code.insert(code.end(), instruction.begin(), instruction.end());
+        } else {
+            // Check the page BC, DE or HL points into, the high byte of the pair.
+            int access = getRegisterAccess(*decoded);
+            if(access != JIT_ACCESS_NONE){
+                byte pageRegister = offsetof(CPU_State, H);
+                if(decoded->opcode == LD_A_mBC || decoded->opcode == LD_mBC_A) pageRegister = offsetof(CPU_State, B);
+                if(decoded->opcode == LD_A_mDE || decoded->opcode == LD_mDE_A) pageRegister = offsetof(CPU_State, D);
+                word instructionPC = pc - decoded->length;
+                cycles instructionCycles = INSTRUCTION_SET[decoded->opcode].cycleCount;
+                if(access & JIT_ACCESS_READ) emitPageGuard(code, cpu->memory->readPageTable, pageRegister, instructionPC, &cpu->cyclesSinceLastInstuction, instructionCycles);
+                if(access & JIT_ACCESS_WRITE) emitPageGuard(code, cpu->memory->writePageTable, pageRegister, instructionPC, &cpu->cyclesSinceLastInstuction, instructionCycles);
+            }
+
+            // Handlers expect PC to point past the instruction and its immediates.
+            setsPC = handlerReadsPC(decoded->opcode);
+            if(setsPC) emitStoreRegisterPair(code, PC_OFFSET, pc);
+            if(decoded->length > 1) emitStoreWord(code, &cpu->parsedData, decoded->parsedData);
+            // CB prefixed instructions call their own handler directly.
+            if(decoded->opcode == PREFIX_CB) emitCall(code, cpu, (const void*)Bit::CB_HANDLERS[decoded->parsedData & 0xFF]);
+            else emitCall(code, cpu, (const void*)INSTRUCTION_HANDLERS[decoded->opcode]);
+            flagsPending = true;
+        }
+
+        blockCycles += INSTRUCTION_SET[decoded->opcode].cycleCount;
+        if(endsBlock(*decoded)) break;
+    }
+
+    // Nothing could be compiled, leave this block to the interpreter.
+    if(blockCycles == 0){
+        block.rejected = true;
+        return;
+    }
+
+    // Jumps set PC themselves, otherwise the block exits past its last instruction.
+    if(!setsPC) emitStoreRegisterPair(code, PC_OFFSET, pc);
+
+    emitEpilogue(code);
+
+    // Flush everything once the arena is full.
+    if(arenaUsed + code.size() > JIT_ARENA_SIZE){
+        flushArena();
+        return;
+    }
+
+    if(!protectArena(arena, true)){
+        std::cerr << "ERROR: Could not make the JIT arena writable!" << std::endl;
+        block.rejected = true;
+        return;
+    }
+    std::memcpy(arena + arenaUsed, code.data(), code.size());
+    if(!protectArena(arena, false)){
+        std::cerr << "ERROR: Could not make the JIT arena executable!" << std::endl;
+        // Nothing in the arena can run now.
+        flushArena();
+        block.rejected = true;
+        return;
+    }
+    block.code = (compiledBlock)(arena + arenaUsed);
+    block.cycleCount = blockCycles;
+    arenaUsed += code.size();
+#endif
+}
@@ -0,0 +1,141 @@
+/**
+ * LoopFusion class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\loopFusion.h"
+#include "include\cpu.h"
+#include <algorithm>
+
+bool LoopFusion::isPlainMemory(word address, uint32_t length, bool allowROM){
+    uint32_t end = address + length - 1;
+    if(allowROM && end <= ROMBANKN_END) return true;
+    if(address >= VRAM_START && end <= VRAM_END) return true;
+    if(address >= WRAMBANK0_START && end <= WRAMBANK1_END) return true;
+    if(address >= OAM_START && end <= OAM_END) return true;
+    if(address >= HRAM_START && end <= HRAM_END) return true;
+    return false;
+}
+
+byte& LoopFusion::counter(CPU* cpu){
+    switch (counterOpcode)
+    {
+    case DEC_B: return cpu->regs.B;
+    case DEC_D: return cpu->regs.D;
+    case DEC_E: return cpu->regs.E;
+    default: return cpu->regs.C;
+    }
+}
+
+void LoopFusion::onBackwardBranch(CPU* cpu, word target){
+    pending = false;
+    // Only loops in ROM, anything else could overwrite itself.
+    if(!DecodeCache::isCacheable(target) || target + 8 > ROMBANKN_END) return;
+
+    // Most backward branches belong to the same few loops, remember the last one.
+    uint32_t key = (cpu->memory->getMappedROMBank(target) << 16) | target;
+    if(key == checkedKey){
+        pending = checkedMatch;
+        return;
+    }
+    checkedKey = key;
+    checkedMatch = false;
+
+    byte code[8];
+    for(int i = 0; i < 8; i++) code[i] = cpu->memory->read(target + i);
+
+    if(code[0] == LD_A_mHLp && code[1] == LD_mDE_A && code[2] == INC_DE){
+        if(code[3] == DEC_BC && code[4] == LD_A_B && code[5] == OR_C && code[6] == JR_NZ_r8 && code[7] == 0xF8){
+            kind = FUSED_LOOP_COPY_BC;
+        // DE holds the destination so only B or C can count.
+        } else if((code[3] == DEC_B || code[3] == DEC_C) && code[4] == JR_NZ_r8 && code[5] == 0xFA){
+            kind = FUSED_LOOP_COPY_8;
+            counterOpcode = code[3];
+        } else return;
+    } else if((code[0] == LD_mHLp_A || code[0] == LD_mHLs_A) && code[2] == JR_NZ_r8 && code[3] == 0xFC){
+        if(code[1] != DEC_B && code[1] != DEC_C && code[1] != DEC_D && code[1] != DEC_E) return;
+        kind = FUSED_LOOP_FILL_8;
+        counterOpcode = code[1];
+        fillDirection = code[0] == LD_mHLp_A ? 1 : -1;
+    } else return;
+
+    head = target;
+    pending = true;
+    checkedMatch = true;
+}
+
+cycles LoopFusion::run(CPU* cpu, cycles maxCycles){
+    if(!pending) return 0;
+    pending = false;
+    // The CPU must have just branched back to the head.
+    if(cpu->regs.PC != head || cpu->cyclesSinceLastInstuction != 0) return 0;
+    if(cpu->activeInterruptVector != 0x0000 || cpu->lowPowerMode || cpu->doubleReadBug) return 0;
+
+    // The calls to `CPU::cycle` taken by one iteration.
+    cycles increment = cpu->doubleSpeedMode ? 2 : 1;
+    auto callsFor = [increment](byte opcode){ return (INSTRUCTION_SET[opcode].cycleCount + increment - 1) / increment; };
+    cycles iterationCycles = 0;
+    uint32_t takenIterations = 0;
+    switch (kind)
+    {
+    case FUSED_LOOP_COPY_BC:
+        iterationCycles = callsFor(LD_A_mHLp) + callsFor(LD_mDE_A) + callsFor(INC_DE) + callsFor(DEC_BC)
+            + callsFor(LD_A_B) + callsFor(OR_C) + callsFor(JR_NZ_r8);
+        takenIterations = (word)(cpu->regs.reg_BC - 1);
+        break;
+    case FUSED_LOOP_COPY_8:
+        iterationCycles = callsFor(LD_A_mHLp) + callsFor(LD_mDE_A) + callsFor(INC_DE) + callsFor(counterOpcode) + callsFor(JR_NZ_r8);
+        takenIterations = (byte)(counter(cpu) - 1);
+        break;
+    case FUSED_LOOP_FILL_8:
+        iterationCycles = callsFor(fillDirection > 0 ? LD_mHLp_A : LD_mHLs_A) + callsFor(counterOpcode) + callsFor(JR_NZ_r8);
+        takenIterations = (byte)(counter(cpu) - 1);
+        break;
+    }
+
+    // Leave the final iteration, which falls through, to the interpreter.
+    uint32_t iterations = std::min(takenIterations, maxCycles / iterationCycles);
+    if(iterations == 0) return 0;
+
+    word source = cpu->regs.reg_HL;
+    word destination = kind == FUSED_LOOP_FILL_8 ? cpu->regs.reg_HL : cpu->regs.reg_DE;
+    if(kind == FUSED_LOOP_FILL_8){
+        word lowest = fillDirection > 0 ? destination : destination - (iterations - 1);
+        if(fillDirection < 0 && destination < iterations - 1) return 0;
+        if(!isPlainMemory(lowest, iterations, false)) return 0;
+    } else {
+        if(!isPlainMemory(source, iterations, true) || !isPlainMemory(destination, iterations, false)) return 0;
+    }
+
+    switch (kind)
+    {
+    case FUSED_LOOP_COPY_BC:
+    case FUSED_LOOP_COPY_8:
+        // Byte by byte, in loop order, so overlapping ranges behave the same.
+        for(uint32_t i = 0; i < iterations; i++){
+            cpu->regs.A = cpu->memory->read(source + i);
+            cpu->memory->write(destination + i, cpu->regs.A);
+        }
+        cpu->regs.reg_HL += iterations;
+        cpu->regs.reg_DE += iterations;
+        if(kind == FUSED_LOOP_COPY_BC){
+            cpu->regs.reg_BC -= iterations;
+            byte lhs = cpu->regs.B;
+            byte rhs = cpu->regs.C;
+            cpu->regs.A = lhs | rhs;
+            cpu->deferFlags(LAZY_FLAGS_OR, lhs, rhs, cpu->regs.A);
+        } else {
+            counter(cpu) -= iterations;
+            cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, counter(cpu));
+        }
+        break;
+    case FUSED_LOOP_FILL_8:
+        for(uint32_t i = 0; i < iterations; i++) cpu->memory->write(destination + fillDirection*(int)i, cpu->regs.A);
+        cpu->regs.reg_HL += fillDirection*(int)iterations;
+        counter(cpu) -= iterations;
+        cpu->deferFlags(LAZY_FLAGS_DEC, 0, 0, counter(cpu));
+        break;
+    }
+
+    cpu->idleLoop.stop();
+    return iterations*iterationCycles;
+}
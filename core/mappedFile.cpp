@@ -0,0 +1,80 @@
+/**
+ * MappedFile class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\mappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+bool MappedFile::open(const std::string& filePath){
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize;
+    if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0){
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if(mapping == NULL){
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if(view == NULL){
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    size = (size_t)fileSize.QuadPart;
+    data = (const byte*)view;
+#else
+    int file = ::open(filePath.c_str(), O_RDONLY);
+    if(file < 0) return false;
+    struct stat fileStats;
+    if(fstat(file, &fileStats) != 0 || fileStats.st_size == 0){
+        ::close(file);
+        return false;
+    }
+    void* view = mmap(nullptr, fileStats.st_size, PROT_READ, MAP_SHARED, file, 0);
+    // The mapping keeps the file referenced.
+    ::close(file);
+    if(view == MAP_FAILED) return false;
+
+    // A ROM is small enough to read ahead in full. Huge pages are only a hint,
+    // kernels which cannot back file mappings with them ignore it.
+    madvise(view, fileStats.st_size, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+    madvise(view, fileStats.st_size, MADV_HUGEPAGE);
+#endif
+    size = fileStats.st_size;
+    data = (const byte*)view;
+#endif
+    return true;
+}
+
+void MappedFile::close(){
+    if(!data) return;
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap((void*)data, size);
+#endif
+    data = nullptr;
+    size = 0;
+}
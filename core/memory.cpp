@@ -8,54 +8,60 @@ date: 2021-11-13
 #include "include\cpu.h"
 #include "include\ioController.h"
 #include "include\ppu.h"
+#include "include\memoryArena.h"
 
+#include <algorithm>
 #include <iostream>
 
 // Enables debug cout statements for this file.
 #define ENABLE_DEBUG_PRINTS false
 
-bool Memory::init(CPU* d_cpu, IOController* d_ioController, PPU* d_ppu, Cartridge* d_cartridge)
+bool Memory::init(CPU* d_cpu, IOController* d_ioController, PPU* d_ppu, Cartridge* d_cartridge, MemoryArena& arena)
 {
     cpu = d_cpu;
     ioController = d_ioController;
     ppu = d_ppu;
     cartridge = d_cartridge;
 
-    // Dynamically alloc the memory arrays.
-    vRAMBank1 = new byte[VRAM_END - VRAM_START + 1];
-    if (vRAMBank1 == nullptr)
-        return false;
-    vRAMBank2 = new byte[VRAM_END - VRAM_START + 1];
-    if (vRAMBank2 == nullptr)
-        return false;
-    wRAM0 = new byte[WRAMBANK0_END - WRAMBANK0_START + 1];
-    if (wRAM0 == nullptr)
-        return false;
-    wRAM1 = new byte[(WRAMBANK1_END - WRAMBANK1_START + 1)*7];
-    if (wRAM1 == nullptr)
-        return false;
-    spriteAttributeTable = new byte[OAM_END - OAM_START + 1];
-    if (spriteAttributeTable == nullptr)
-        return false;
-    hRAM = new byte[HRAM_END - HRAM_START + 1];
-    if (hRAM == nullptr)
+    // Take the memory blocks from the arena, see `arenaSize` for their sizes.
+    vRAMBank1 = arena.allocate<byte>(VRAM_END - VRAM_START + 1);
+    vRAMBank2 = arena.allocate<byte>(VRAM_END - VRAM_START + 1);
+    wRAM0 = arena.allocate<byte>(WRAMBANK0_END - WRAMBANK0_START + 1);
+    wRAM1 = arena.allocate<byte>((WRAMBANK1_END - WRAMBANK1_START + 1)*7);
+    spriteAttributeTable = arena.allocate<byte>(OAM_END - OAM_START + 1);
+    hRAM = arena.allocate<byte>(HRAM_END - HRAM_START + 1);
+    if (vRAMBank1 == nullptr || vRAMBank2 == nullptr || wRAM0 == nullptr || wRAM1 == nullptr
+        || spriteAttributeTable == nullptr || hRAM == nullptr)
         return false;
+    updatePageTable();
 
     // All allocs successful.
     return true;
 }
+
+size_t Memory::arenaSize()
+{
+    return MemoryArena::blockSize<byte>(VRAM_END - VRAM_START + 1) * 2
+        + MemoryArena::blockSize<byte>(WRAMBANK0_END - WRAMBANK0_START + 1)
+        + MemoryArena::blockSize<byte>((WRAMBANK1_END - WRAMBANK1_START + 1)*7)
+        + MemoryArena::blockSize<byte>(OAM_END - OAM_START + 1)
+        + MemoryArena::blockSize<byte>(HRAM_END - HRAM_START + 1);
+}
+
 bool Memory::destroy()
 {
     if (vRAMBank1 == nullptr)
         return false;
 
-    // Deallocates the data.
-    delete[] vRAMBank1;
-    delete[] vRAMBank2;
-    delete[] wRAM0;
-    delete[] wRAM1;
-    delete[] spriteAttributeTable;
-    delete[] hRAM;
+    // The arena owns the data, only forget it.
+    vRAMBank1 = nullptr;
+    vRAMBank2 = nullptr;
+    wRAM0 = nullptr;
+    wRAM1 = nullptr;
+    spriteAttributeTable = nullptr;
+    hRAM = nullptr;
+    std::fill(readPageTable, readPageTable + MEMORY_PAGE_COUNT, nullptr);
+    std::fill(writePageTable, writePageTable + MEMORY_PAGE_COUNT, nullptr);
 
     return true;
 }
@@ -102,10 +108,17 @@ void Memory::zeroAllBlocksOfMemory(){
     memoryControllerRead = NULL;
     memoryControllerSaveToState = NULL;
     memoryControllerLoadFromState = NULL;
+    memoryControllerROMBank = NULL;
+    updateMappedROMBanks();
+    cartridgeROMBank0 = nullptr;
+    cartridgeROMBankN = nullptr;
+    cartridgeRAMBank = nullptr;
+    cartridgeRAMLength = 0;
     // Clear control vars.
     dirtyTiles.clear();
     selectedWRAMBank = 1;
     selectedVRAMBank = 0;
+    updatePageTable();
 
     // Zero all blocks.
     std::fill(
@@ -190,6 +203,114 @@ void Memory::initializeVRAM(){
     }
 }
 
+void Memory::setMemoryController(
+    memoryControllerWriteFunctionTemplate writeFunction, 
+    memoryControllerReadFunctionTemplate readFunction,
+    memoryControllerSaveToStateFunctionTemplate saveStateFunction,
+    memoryControllerLoadFromStateFunctionTemplate loadStateFunction,
+    memoryControllerROMBankFunctionTemplate romBankFunction
+){
+    memoryControllerWrite = writeFunction;
+    memoryControllerRead = readFunction;
+    memoryControllerSaveToState = saveStateFunction;
+    memoryControllerLoadFromState = loadStateFunction;
+    memoryControllerROMBank = romBankFunction;
+    updateMappedROMBanks();
+
+    // The contents of ROM changed, drop any code decoded from the old cartridge.
+    cpu->clearDecodeCache();
+}
+
+void Memory::setFlatBus(byte* bus){
+    flatBus = bus;
+    updatePageTable();
+}
+
+void Memory::mapPages(byte** pageTable, word start, word end, byte* block){
+    for (int page = start >> 8; page <= end >> 8; page++){
+        pageTable[page] = block ? block + (page << 8) - start : nullptr;
+    }
+}
+void Memory::mapPages(const byte** pageTable, word start, word end, const byte* block){
+    for (int page = start >> 8; page <= end >> 8; page++){
+        pageTable[page] = block ? block + (page << 8) - start : nullptr;
+    }
+}
+
+void Memory::updatePageTable(){
+    if (flatBus){
+        mapPages(readPageTable, 0x0000, 0xFFFF, flatBus);
+        mapPages(writePageTable, 0x0000, 0xFFFF, flatBus);
+        return;
+    }
+
+    // Writes to ROM (the memory controller's registers), OAM (which shares
+    // its page with the unusable region) and the I/O page are handled by the slow path.
+    std::fill(readPageTable, readPageTable + MEMORY_PAGE_COUNT, nullptr);
+    std::fill(writePageTable, writePageTable + MEMORY_PAGE_COUNT, nullptr);
+    updateCartridgePages();
+    if (wRAM0 == nullptr) return;
+    mapPages(readPageTable, WRAMBANK0_START, WRAMBANK0_END, wRAM0);
+    mapPages(writePageTable, WRAMBANK0_START, WRAMBANK0_END, wRAM0);
+    mapPages(readPageTable, ECHO_START, ECHO_START + WRAMBANK0_END - WRAMBANK0_START, wRAM0);
+    mapPages(writePageTable, ECHO_START, ECHO_START + WRAMBANK0_END - WRAMBANK0_START, wRAM0);
+    updateVRAMPages();
+    updateWRAMPages();
+}
+
+void Memory::setCartridgeBanks(const byte* romBank0, const byte* romBankN, byte* ramBank, word ramLength){
+    cartridgeROMBank0 = romBank0;
+    cartridgeROMBankN = romBankN;
+    cartridgeRAMBank = ramBank;
+    cartridgeRAMLength = ramLength;
+    updateCartridgePages();
+    // Keep the bank numbers in step with what is mapped.
+    updateMappedROMBanks();
+}
+
+void Memory::updateCartridgePages(){
+    if (flatBus) return;
+    mapPages(readPageTable, ROMBANK0_START, ROMBANK0_END, cartridgeROMBank0);
+    mapPages(readPageTable, ROMBANKN_START, ROMBANKN_END, cartridgeROMBankN);
+    mapPages(readPageTable, EXTERNALRAM_START, EXTERNALRAM_END, nullptr);
+    mapPages(writePageTable, EXTERNALRAM_START, EXTERNALRAM_END, nullptr);
+    if (cartridgeRAMBank == nullptr || cartridgeRAMLength < MEMORY_PAGE_SIZE) return;
+
+    // Anything past the end of a small RAM is left to the memory controller.
+    word ramEnd = EXTERNALRAM_START + cartridgeRAMLength - 1;
+    mapPages(readPageTable, EXTERNALRAM_START, ramEnd, cartridgeRAMBank);
+    mapPages(writePageTable, EXTERNALRAM_START, ramEnd, cartridgeRAMBank);
+}
+
+void Memory::updateVRAMPages(){
+    if (flatBus || vRAMBank1 == nullptr) return;
+    byte* vramBank = selectedVRAMBank ? vRAMBank1 : vRAMBank2;
+    mapPages(readPageTable, VRAM_START, VRAM_END, vramBank);
+    // Writes to tile data are tracked by `updateDirtyVRAM`, only the tile maps can be written directly.
+    mapPages(writePageTable, TILE_DATA_END, VRAM_END, vramBank + TILE_DATA_END - VRAM_START);
+}
+
+void Memory::updateWRAMPages(){
+    if (flatBus || wRAM1 == nullptr) return;
+    byte* wramBank = wRAM1 + (WRAMBANK1_END - WRAMBANK1_START + 1)*(selectedWRAMBank-1);
+    mapPages(readPageTable, WRAMBANK1_START, WRAMBANK1_END, wramBank);
+    mapPages(writePageTable, WRAMBANK1_START, WRAMBANK1_END, wramBank);
+    // The echo of bank 1 stops short at FDFF.
+    word echoStart = ECHO_START + WRAMBANK1_START - WRAMBANK0_START;
+    mapPages(readPageTable, echoStart, ECHO_END, wramBank);
+    mapPages(writePageTable, echoStart, ECHO_END, wramBank);
+}
+
+void Memory::updateMappedROMBanks(){
+    if(memoryControllerROMBank){
+        mappedROMBanks[0] = memoryControllerROMBank(ROMBANK0_START);
+        mappedROMBanks[1] = memoryControllerROMBank(ROMBANKN_START);
+    } else {
+        mappedROMBanks[0] = 0;
+        mappedROMBanks[1] = 1;
+    }
+}
+
 void Memory::updateDirtyVRAM(word address, bool d_selectedVRAMBank){
     // Filter out non-tile map events.
     if(address < TILE_DATA_START || address >= TILE_DATA_END){
@@ -202,17 +323,31 @@ void Memory::updateDirtyVRAM(word address, bool d_selectedVRAMBank){
     dirtyTiles.insert(effectedTile);
 }
 
-void Memory::write(word address, byte d_data)
+void Memory::updateDirtyVRAM(word address, word length, bool d_selectedVRAMBank){
+    // Clip the range to the tile data.
+    int start = std::max((int)address, TILE_DATA_START);
+    int end = std::min((int)address + length, TILE_DATA_END);
+    if(start >= end) return;
+
+    int firstTile = ((start - TILE_DATA_START) >> 4) + TILES_PER_BANK * d_selectedVRAMBank;
+    int lastTile = ((end - 1 - TILE_DATA_START) >> 4) + TILES_PER_BANK * d_selectedVRAMBank;
+    // The tiles are in order, hint each one in at the end of the set.
+    for(int tile = firstTile; tile <= lastTile; tile++) dirtyTiles.insert(dirtyTiles.end(), tile);
+}
+
+void Memory::writeSlowPath(word address, byte d_data)
 {
     // Memory Map.
     // 0000-3FFF   16KB ROM Bank 00     (in cartridge, fixed at bank 00).
     if (address >= ROMBANK0_START && address <= ROMBANK0_END){
         if(memoryControllerWrite) memoryControllerWrite(address, d_data);
+        updateMappedROMBanks();
     }
 
     // 4000-7FFF   16KB ROM Bank 01..NN (in cartridge, switchable bank number).
     else if (address >= ROMBANKN_START && address <= ROMBANKN_END){
         if(memoryControllerWrite) memoryControllerWrite(address, d_data);
+        updateMappedROMBanks();
     }
 
     // 8000-9FFF   8KB Video RAM (VRAM) (switchable bank 0-1 in CGB Mode).
@@ -264,6 +399,7 @@ void Memory::write(word address, byte d_data)
     // FF00-FF7F   I/O Ports.
     else if (address >= IOPORTS_START && address <= IOPORTS_END)
     {
+        ioAccesses++;
         ioController->write(address, d_data);
     }
 
@@ -276,11 +412,12 @@ void Memory::write(word address, byte d_data)
     // FFFF        Interrupt Enable Register.
     else if (address == INTERRUPT_ENABLE_REGISTER_ADDR)
     {
+        ioAccesses++;
         interruptEnableRegister = d_data;
     }
 }
 
-const byte Memory::read(word address)
+const byte Memory::readSlowPath(word address)
 {
     // Memory Map.
 
@@ -347,6 +484,7 @@ const byte Memory::read(word address)
     // FF00-FF7F   I/O Ports.
     else if (address >= IOPORTS_START && address <= IOPORTS_END)
     {
+        ioAccesses++;
         return ioController->read(address);
     }
 
@@ -359,13 +497,33 @@ const byte Memory::read(word address)
     // FFFF        Interrupt Enable Register.
     else if (address == INTERRUPT_ENABLE_REGISTER_ADDR)
     {
+        ioAccesses++;
         return interruptEnableRegister;
     }
     
     return HIGH_IMPEDANCE;
 }
+const byte* Memory::getReadBlock(word address, word length){
+    int firstPage = address >> 8;
+    int lastPage = ((int)address + length - 1) >> 8;
+    if(length == 0 || lastPage >= MEMORY_PAGE_COUNT) return nullptr;
+
+    // Every page has to be mapped, and mapped straight after the one before it.
+    const byte* page = readPageTable[firstPage];
+    if(!page) return nullptr;
+    for(int i = firstPage + 1; i <= lastPage; i++){
+        if(readPageTable[i] != page + (i - firstPage) * MEMORY_PAGE_SIZE) return nullptr;
+    }
+    return page + (address & 0xFF);
+}
+
 byte *Memory::getBytePointer(word address)
 {
+    // Plain memory is in the page table. Tile data is not as it has to be
+    // marked dirty, the caller may write through the pointer.
+    byte* page = writePageTable[address >> 8];
+    if (page) return page + (address & 0xFF);
+
     // Memory Map.
 
     // 0000-3FFF   16KB ROM Bank 00     (in cartridge, fixed at bank 00).
@@ -456,6 +614,7 @@ void Memory::sendHBlankToIO(){ioController->receiveHBlank();}
 void Memory::setActiveWRAMBank(byte wramBank){
     selectedWRAMBank = wramBank & 0b111;
     if (selectedWRAMBank == 0) selectedWRAMBank = 1;
+    updateWRAMPages();
 }
 
 void Memory::raiseJoypadInterrupt(){
@@ -544,5 +703,7 @@ void Memory::loadFromState(std::ifstream & stateFile){
 
     // Handle On cartridge state.
     if(memoryControllerLoadFromState) memoryControllerLoadFromState(stateFile);
+    updateMappedROMBanks();
+    updatePageTable();
 }
 
@@ -0,0 +1,29 @@
+/**
+ * MemoryArena class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\memoryArena.h"
+#include <cstring>
+#include <iostream>
+#include <new>
+
+bool MemoryArena::init(size_t capacity){
+    destroy();
+    data = (byte*)::operator new(capacity, std::align_val_t(MEMORY_ARENA_ALIGNMENT), std::nothrow);
+    if(data == nullptr){
+        std::cout << "ERROR: Could not allocate " << capacity << " bytes for the emulator's memory!" << std::endl;
+        return false;
+    }
+    std::memset(data, 0, capacity);
+    size = capacity;
+    used = 0;
+    return true;
+}
+
+void MemoryArena::destroy(){
+    if(data == nullptr) return;
+    ::operator delete(data, std::align_val_t(MEMORY_ARENA_ALIGNMENT));
+    data = nullptr;
+    size = 0;
+    used = 0;
+}
@@ -4,6 +4,8 @@ The class implementation for the emulator's PPU / LCD  display.
 #include "include/ppu.h"
 #include "include/memory.h"
 #include "include/register.h"
+#include "include/memoryArena.h"
+#include "include/scheduler.h"
 #include <set>
 #include <algorithm>
 
@@ -47,47 +49,42 @@ void OAMEntry::loadFromState(byte*& readBuffer){
     std::memcpy(&colourPalette, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
 }
 
-bool PPU::init(){
+bool PPU::init(MemoryArena& arena){
    // Create the background maps.
-    backgroundMap0 = new uint8_t[INT8_PER_BG_MAP];
-    if (backgroundMap0 == nullptr)
-        return false;
-    backgroundMap1 = new uint8_t[INT8_PER_BG_MAP];
-    if (backgroundMap1 == nullptr)
-        return false;
+    backgroundMap0 = arena.allocate<uint8_t>(INT8_PER_BG_MAP);
+    backgroundMap1 = arena.allocate<uint8_t>(INT8_PER_BG_MAP);
     // Create the tile map.
-    tileMap = new uint8_t[PIXELS_PER_TILE * TILES_PER_BANK * 2];
-    if (tileMap == nullptr)
-        return false;
-    nonColouredTile = new uint8_t[INT8_PER_TILE];
-    if (nonColouredTile == nullptr)
-        return false;
-    objectAttributeMemory = new OAMEntry[NUMBER_OF_OBJECTS];
-    if (objectAttributeMemory == nullptr)
-        return false;
+    tileMap = arena.allocate<uint8_t>(PIXELS_PER_TILE * TILES_PER_BANK * 2);
+    nonColouredTile = arena.allocate<uint8_t>(INT8_PER_TILE);
+    objectAttributeMemory = arena.allocate<OAMEntry>(NUMBER_OF_OBJECTS);
 
     // Video buffer and scanline helpers.
-    videoBuffer = new uint8_t[INT8_PER_SCREEN];
-    if (videoBuffer == nullptr)
-        return false;
-    disabledVideoBuffer = new uint8_t[INT8_PER_SCREEN];
-    if (disabledVideoBuffer == nullptr)
-        return false;
-    backgroundScanlinePixels = new uint8_t[SCREEN_WIDTH*3];
-    if (backgroundScanlinePixels == nullptr)
+    videoBuffer = arena.allocate<uint8_t>(INT8_PER_SCREEN);
+    disabledVideoBuffer = arena.allocate<uint8_t>(INT8_PER_SCREEN);
+    backgroundScanlinePixels = arena.allocate<uint8_t>(SCREEN_WIDTH*3);
+    windowScanlinePixels = arena.allocate<uint8_t>(SCREEN_WIDTH*3);
+    lowPriorityObjectPixels = arena.allocate<uint8_t>(SCREEN_WIDTH*2);
+    highPriorityObjectPixels = arena.allocate<uint8_t>(SCREEN_WIDTH*2);
+
+    if (backgroundMap0 == nullptr || backgroundMap1 == nullptr || tileMap == nullptr
+        || nonColouredTile == nullptr || objectAttributeMemory == nullptr)
         return false;
-    windowScanlinePixels = new uint8_t[SCREEN_WIDTH*3];
-    if (windowScanlinePixels == nullptr)
-        return false;
-    lowPriorityObjectPixels = new uint8_t[SCREEN_WIDTH*2];
-    if (lowPriorityObjectPixels == nullptr)
-        return false;
-    highPriorityObjectPixels = new uint8_t[SCREEN_WIDTH*2];
-    if (highPriorityObjectPixels == nullptr)
+    if (videoBuffer == nullptr || disabledVideoBuffer == nullptr || backgroundScanlinePixels == nullptr
+        || windowScanlinePixels == nullptr || lowPriorityObjectPixels == nullptr || highPriorityObjectPixels == nullptr)
         return false;
     // All alloc successful.
     return true;
 }
+
+size_t PPU::arenaSize(){
+    return MemoryArena::blockSize<uint8_t>(INT8_PER_BG_MAP) * 2
+        + MemoryArena::blockSize<uint8_t>(PIXELS_PER_TILE * TILES_PER_BANK * 2)
+        + MemoryArena::blockSize<uint8_t>(INT8_PER_TILE)
+        + MemoryArena::blockSize<OAMEntry>(NUMBER_OF_OBJECTS)
+        + MemoryArena::blockSize<uint8_t>(INT8_PER_SCREEN) * 2
+        + MemoryArena::blockSize<uint8_t>(SCREEN_WIDTH*3) * 2
+        + MemoryArena::blockSize<uint8_t>(SCREEN_WIDTH*2) * 2;
+}
 void PPU::zeroAllBlocksOfMemory(){
     std::fill(
         backgroundMap0, 
@@ -162,6 +159,7 @@ void PPU::reset(){
     // The current mode of the PPU. This controls what the PPU is doing per cycle. 
     mode = 2;
     cyclesCounter = 0;
+    syncedAt = scheduler ? scheduler->getNow() : 0;
     CGBMode = false;
 
     // Clear the buffers.
@@ -182,21 +180,26 @@ void PPU::reset(){
 }
 
 void PPU::destroy(){
-    // Deallocates the data.
-    delete[] backgroundMap0;
-    delete[] backgroundMap1;
-    delete[] tileMap;
-    delete[] nonColouredTile;
-    delete[] objectAttributeMemory;
-
-    delete[] videoBuffer;
-    delete[] windowScanlinePixels;
-    delete[] backgroundScanlinePixels;
-    delete[] lowPriorityObjectPixels;
-    delete[] highPriorityObjectPixels;
+    // The arena owns the data, only forget it.
+    backgroundMap0 = nullptr;
+    backgroundMap1 = nullptr;
+    tileMap = nullptr;
+    nonColouredTile = nullptr;
+    objectAttributeMemory = nullptr;
+
+    videoBuffer = nullptr;
+    disabledVideoBuffer = nullptr;
+    windowScanlinePixels = nullptr;
+    backgroundScanlinePixels = nullptr;
+    lowPriorityObjectPixels = nullptr;
+    highPriorityObjectPixels = nullptr;
 }
 
 void PPU::cycle(){
+    // Count everything up to this cycle, and this cycle itself.
+    catchUp();
+    syncedAt++;
+
     // Pause execution if the PPU is disabled.
     if(!ppuEnable) return;
 
@@ -325,6 +328,44 @@ void PPU::cycle(){
     }
 }
 
+void PPU::catchUp(){
+    uint64_t now = scheduler->getNow();
+    // Nothing to do, or called from within `cycle`.
+    if(now <= syncedAt) return;
+    advance(now - syncedAt);
+    syncedAt = now;
+}
+
+void PPU::registerWritten(){
+    catchUp();
+    scheduler->schedule(EVENT_PPU, 0);
+}
+
+cycles PPU::cyclesUntilEvent(){
+    if(!ppuEnable) return UINT32_MAX;
+    catchUp();
+    // A STAT interrupt is still flagged, `cycle` clears it.
+    if(readBit(memory->read(INTERRUPT_FLAG_REGISTER_ADDR), 1)) return 0;
+    // The work at the start of a mode is due.
+    if(cyclesCounter == 0) return 0;
+
+    cycles modeLength = 0;
+    switch(mode){
+        case 0: modeLength = MODE0_LEN; break;
+        case 1: modeLength = MODE1_LEN; break;
+        case 2: modeLength = MODE2_LEN; break;
+        case 3: modeLength = MODE3_LEN; break;
+        default: return 0;
+    }
+    if(cyclesCounter + 1 >= modeLength) return 0;
+    return modeLength - cyclesCounter - 1;
+}
+
+void PPU::advance(cycles numCycles){
+    if(!ppuEnable) return;
+    cyclesCounter += numCycles;
+}
+
 void PPU::increaseScanline(){
     // Increment the scanline and move to the next mode depending on which scanline we are on.
     scanline++;
@@ -843,6 +884,9 @@ void PPU::determineObjectToRender(){
 }
 
 void PPU::saveToState(std::ofstream & stateFile){
+    // Save the cycle count as of now.
+    catchUp();
+
     int palletteCopySize = sizeof(byte)*4*SWATCHES_PER_PALETTE*NUMBER_OF_PALETTES;
     int displayLayerSize = sizeof(uint8_t)*INT8_PER_SCREEN;
     int bgMapSize = sizeof(uint8_t)*INT8_PER_BG_MAP;
@@ -946,6 +990,7 @@ void PPU::loadFromState(std::ifstream & stateFile){
     std::memcpy(&scanline, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
 
     std::memcpy(&cyclesCounter, readBuffer, sizeof(cycles)); readBuffer+=sizeof(cycles);
+    syncedAt = scheduler->getNow();
 
     std::memcpy(objectColours, readBuffer, palletteCopySize); readBuffer+=palletteCopySize;
     std::memcpy(backgroundColours, readBuffer, palletteCopySize); readBuffer+=palletteCopySize;
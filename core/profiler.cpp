@@ -0,0 +1,153 @@
+/**
+ * Profiler class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\profiler.h"
+#include "include\instructionSet.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+Profiler::~Profiler(){
+    reset();
+}
+
+void Profiler::reset(){
+    for(ProfileAddressCounter* bankTable : romBanks) delete[] bankTable;
+    romBanks.clear();
+    delete[] ramTable;
+    ramTable = nullptr;
+
+    std::fill(std::begin(opcodes), std::end(opcodes), ProfileCounter{});
+    std::fill(std::begin(cbOpcodes), std::end(cbOpcodes), ProfileCounter{});
+    totalCycles = 0;
+}
+
+ProfileAddressCounter& Profiler::addressCounter(uint32_t bank, word pc){
+    if(bank == PROFILER_NO_BANK){
+        if(!ramTable) ramTable = new ProfileAddressCounter[0x10000 - VRAM_START]();
+        return ramTable[pc - VRAM_START];
+    }
+
+    // A bank can be mapped at 0x0000 or 0x4000, keep the two apart.
+    uint32_t table = (bank << 1) | (pc >> 14);
+    if(table >= romBanks.size()) romBanks.resize(table + 1, nullptr);
+    if(!romBanks[table]) romBanks[table] = new ProfileAddressCounter[ROM_BANK_SIZE]();
+    return romBanks[table][pc & (ROM_BANK_SIZE - 1)];
+}
+
+std::string Profiler::instructionName(byte opcode, byte cbOpcode){
+    if(opcode != PREFIX_CB) return INSTRUCTION_SET[opcode].opcode;
+
+    static const char* SHIFT_NAMES[] = {"RLC", "RRC", "RL", "RR", "SLA", "SRA", "SWAP", "SRL"};
+    static const char* BIT_NAMES[] = {"BIT", "RES", "SET"};
+    static const char* REGISTER_NAMES[] = {"B", "C", "D", "E", "H", "L", "mHL", "A"};
+
+    std::string target = REGISTER_NAMES[cbOpcode & 0x07];
+    if(cbOpcode < 0x40) return std::string(SHIFT_NAMES[cbOpcode >> 3]) + "_" + target;
+    return std::string(BIT_NAMES[(cbOpcode >> 6) - 1]) + "_" + std::to_string((cbOpcode >> 3) & 0x07) + "_" + target;
+}
+
+std::vector<ProfileHotSpot> Profiler::opcodeRows(bool cb){
+    std::vector<ProfileHotSpot> rows;
+    const ProfileCounter* counters = cb ? cbOpcodes : opcodes;
+    for(int opcode = 0; opcode < 256; opcode++){
+        if(counters[opcode].executions == 0) continue;
+        rows.push_back({PROFILER_NO_BANK, 0,
+            cb ? (byte)PREFIX_CB : (byte)opcode, cb ? (byte)opcode : (byte)0,
+            counters[opcode].executions, counters[opcode].cycles});
+    }
+    std::sort(rows.begin(), rows.end(), [](const ProfileHotSpot& a, const ProfileHotSpot& b){ return a.cycles > b.cycles; });
+    return rows;
+}
+
+std::vector<ProfileHotSpot> Profiler::addressRows(size_t count){
+    std::vector<ProfileHotSpot> rows;
+    auto collect = [&rows](uint32_t bank, word base, const ProfileAddressCounter* table, uint32_t size){
+        for(uint32_t i = 0; i < size; i++){
+            const ProfileAddressCounter& counter = table[i];
+            if(counter.executions == 0) continue;
+            rows.push_back({bank, (word)(base + i), counter.opcode, counter.cbOpcode, counter.executions, counter.cycles});
+        }
+    };
+    for(uint32_t table = 0; table < romBanks.size(); table++){
+        if(romBanks[table]) collect(table >> 1, (table & 1) ? ROMBANKN_START : ROMBANK0_START, romBanks[table], ROM_BANK_SIZE);
+    }
+    if(ramTable) collect(PROFILER_NO_BANK, VRAM_START, ramTable, 0x10000 - VRAM_START);
+
+    auto byCycles = [](const ProfileHotSpot& a, const ProfileHotSpot& b){ return a.cycles > b.cycles; };
+    if(count < rows.size()){
+        std::partial_sort(rows.begin(), rows.begin() + count, rows.end(), byCycles);
+        rows.resize(count);
+    } else {
+        std::sort(rows.begin(), rows.end(), byCycles);
+    }
+    return rows;
+}
+
+bool Profiler::writeReport(const std::string& filePath){
+    std::ofstream reportFile(filePath);
+    if(!reportFile.is_open()){
+        std::cout << "ERROR: Could not write the profile \"" << filePath << "\"!" << std::endl;
+        return false;
+    }
+
+    std::vector<ProfileHotSpot> sections[3] = {opcodeRows(false), opcodeRows(true), addressRows(SIZE_MAX)};
+    const char* sectionNames[3] = {"opcodes", "cbOpcodes", "addresses"};
+    bool json = filePath.size() >= 5 && filePath.compare(filePath.size() - 5, 5, ".json") == 0;
+
+    auto hex = [](uint32_t value, int width){
+        std::ostringstream text;
+        text << std::hex << std::uppercase << std::setw(width) << std::setfill('0') << value;
+        return text.str();
+    };
+    auto percent = [this](uint64_t rowCycles){
+        return totalCycles == 0 ? 0.0 : 100.0 * (double)rowCycles / (double)totalCycles;
+    };
+
+    reportFile << std::fixed << std::setprecision(3);
+    if(json){
+        reportFile << "{\n  \"totalCycles\": " << totalCycles;
+        for(int section = 0; section < 3; section++){
+            reportFile << ",\n  \"" << sectionNames[section] << "\": [";
+            bool first = true;
+            for(const ProfileHotSpot& row : sections[section]){
+                reportFile << (first ? "\n" : ",\n") << "    {";
+                first = false;
+                if(section == 2){
+                    reportFile << "\"bank\": " << (row.bank == PROFILER_NO_BANK ? std::string("null") : std::to_string(row.bank))
+                               << ", \"pc\": \"0x" << hex(row.pc, 4) << "\", ";
+                } else {
+                    reportFile << "\"opcode\": \"0x" << hex(section == 1 ? row.cbOpcode : row.opcode, 2) << "\", ";
+                }
+                reportFile << "\"instruction\": \"" << instructionName(row.opcode, row.cbOpcode) << "\""
+                           << ", \"executions\": " << row.executions
+                           << ", \"cycles\": " << row.cycles
+                           << ", \"percent\": " << percent(row.cycles) << "}";
+            }
+            reportFile << (first ? "]" : "\n  ]");
+        }
+        reportFile << "\n}\n";
+    } else {
+        // One table, the first column tells the three reports apart.
+        reportFile << "report,bank,pc,opcode,instruction,executions,cycles,percent\n";
+        for(int section = 0; section < 3; section++){
+            for(const ProfileHotSpot& row : sections[section]){
+                reportFile << sectionNames[section] << ",";
+                if(section == 2){
+                    if(row.bank != PROFILER_NO_BANK) reportFile << row.bank;
+                    reportFile << ",0x" << hex(row.pc, 4) << ",";
+                } else {
+                    reportFile << ",,";
+                }
+                reportFile << "0x" << hex(row.opcode, 2);
+                if(row.opcode == PREFIX_CB) reportFile << hex(row.cbOpcode, 2);
+                reportFile << "," << instructionName(row.opcode, row.cbOpcode)
+                           << "," << row.executions
+                           << "," << row.cycles
+                           << "," << percent(row.cycles) << "\n";
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,16 @@
+/**
+ * Scheduler class implementation for a GameBoy Color emulator.
+ */
+
+#include "include\scheduler.h"
+#include <algorithm>
+
+void Scheduler::reset(){
+    std::fill(eventTimes, eventTimes + SCHEDULER_EVENT_COUNT, SCHEDULER_NEVER);
+}
+
+cycles Scheduler::cyclesUntilNextEvent(){
+    uint64_t next = *std::min_element(eventTimes, eventTimes + SCHEDULER_EVENT_COUNT);
+    if(next <= now) return 0;
+    return (cycles)std::min<uint64_t>(next - now, UINT32_MAX - 1);
+}
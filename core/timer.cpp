@@ -3,35 +3,87 @@ The class implementation for the emulator's external timer.
 */
 
 #include "include/timer.h"
+#include <algorithm>
 
-void Timer::setIncrementFrequency(cycles frequency){
-    clockSpeed = frequency;
-}
-void Timer::setRunning(bool state){
-    running = state;
-}
-
-void Timer::cycle(bool cpuDoubleSpeed, voidFuncWithNoArguments overflowOperation){
-    // Return early if not running.
+void Timer::update(uint64_t now){
+    if(now <= updatedAt) return;
+    uint64_t elapsed = now - updatedAt;
+    updatedAt = now;
     if(!running || clockSpeed == 0) return;
-    cyclesPassed ++;
-    if(cpuDoubleSpeed) cyclesPassed ++;
 
-    // Increment the register at the desired frequency.
+    cycles increment = doubleSpeed ? 2 : 1;
+    // Lowering the frequency can leave more cycles banked than an increment
+    // needs. The next cycle still only increments the register once.
     if(cyclesPassed >= clockSpeed){
         data += 1;
-        cyclesPassed = cyclesPassed % clockSpeed;
-        // Perform the overflow action on overflow.
-        if(data == 0 && overflowOperation!=NULL){
-            overflowOperation();
-        }
+        cyclesPassed = (cyclesPassed + increment) % clockSpeed;
+        elapsed--;
+    }
+    // From then on the register goes up once every `clockSpeed` cycles.
+    uint64_t counted = cyclesPassed + elapsed*increment;
+    data += (byte)(counted / clockSpeed);
+    cyclesPassed = (cycles)(counted % clockSpeed);
+}
+
+void Timer::scheduleOverflow(){
+    overflowAt = SCHEDULER_NEVER;
+    if(!running || clockSpeed == 0) return;
 
+    cycles increment = doubleSpeed ? 2 : 1;
+    uint64_t from = updatedAt;
+    uint64_t banked = cyclesPassed;
+    uint32_t incrementsLeft = 0x100 - data;
+    // See `update`, the first cycle increments the register straight away.
+    if(banked >= clockSpeed){
+        if(incrementsLeft == 1){
+            overflowAt = from;
+            return;
+        }
+        incrementsLeft--;
+        banked = (banked + increment) % clockSpeed;
+        from++;
     }
+    uint64_t needed = (uint64_t)clockSpeed*incrementsLeft - banked;
+    overflowAt = from + (needed + increment - 1) / increment - 1;
 }
 
-void Timer::resetTimer(byte resetValue){
+void Timer::setIncrementFrequency(uint64_t now, cycles frequency){
+    update(now);
+    clockSpeed = frequency;
+    scheduleOverflow();
+}
+void Timer::setRunning(uint64_t now, bool state){
+    update(now);
+    running = state;
+    scheduleOverflow();
+}
+void Timer::setDoubleSpeed(uint64_t now, bool state){
+    update(now);
+    doubleSpeed = state;
+    scheduleOverflow();
+}
+
+void Timer::resetTimer(uint64_t now, byte resetValue){
+    update(now);
     cyclesPassed = 0;
     data = resetValue;
+    scheduleOverflow();
+}
+
+bool Timer::cycle(uint64_t now, byte reloadValue){
+    if(now != overflowAt) return false;
+    update(now + 1);
+    // Perform the overflow action.
+    cyclesPassed = 0;
+    data = reloadValue;
+    scheduleOverflow();
+    return true;
+}
+
+cycles Timer::cyclesUntilOverflow(uint64_t now){
+    if(overflowAt == SCHEDULER_NEVER) return UINT32_MAX;
+    if(overflowAt <= now) return 0;
+    return (cycles)std::min<uint64_t>(overflowAt - now, UINT32_MAX - 1);
 }
 
 void Timer::saveToState(byte*& writeBuffer){
@@ -41,9 +93,11 @@ void Timer::saveToState(byte*& writeBuffer){
     std::memcpy(writeBuffer, &running, sizeof(bool)); writeBuffer+=sizeof(bool);
 }
 
-void Timer::loadFromState(byte*& readBuffer){
+void Timer::loadFromState(byte*& readBuffer, uint64_t now){
     std::memcpy(&data, readBuffer, sizeof(byte)); readBuffer+=sizeof(byte);
     std::memcpy(&clockSpeed, readBuffer, sizeof(cycles)); readBuffer+=sizeof(cycles);
     std::memcpy(&cyclesPassed, readBuffer, sizeof(cycles)); readBuffer+=sizeof(cycles);
     std::memcpy(&running, readBuffer, sizeof(bool)); readBuffer+=sizeof(bool);
-}
\ No newline at end of file
+    updatedAt = now;
+    scheduleOverflow();
+}
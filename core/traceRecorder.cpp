@@ -0,0 +1,203 @@
+/**
+ * TraceRecorder and TraceReader class implementations for a GameBoy Color emulator.
+ */
+
+#include "include\traceRecorder.h"
+#include "include\profiler.h"
+#include <chrono>
+#include <cstring>
+#include <deque>
+
+// The most records the writer drains before handing room back to the CPU.
+#define TRACE_DRAIN_CHUNK (TRACE_BUFFER_SIZE / 4)
+// Records shown before the first difference by `TraceReader::diff`.
+#define TRACE_DIFF_CONTEXT 8
+
+bool TraceRecorder::start(const std::string& filePath, bool compress){
+    stop();
+
+    traceFile = fopen(filePath.c_str(), "wb");
+    if(!traceFile){
+        std::cout << "ERROR: Could not write the trace \"" << filePath << "\"!" << std::endl;
+        return false;
+    }
+
+    compressed = compress;
+    uint32_t flags = compressed ? TRACE_FLAG_COMPRESSED : 0;
+    uint32_t recordSize = sizeof(TraceRecord);
+    fwrite(TRACE_FILE_MAGIC, 1, sizeof(TRACE_FILE_MAGIC), traceFile);
+    fwrite(&flags, sizeof(flags), 1, traceFile);
+    fwrite(&recordSize, sizeof(recordSize), 1, traceFile);
+
+    if(!buffer) buffer = new TraceRecord[TRACE_BUFFER_SIZE];
+    writeIndex.store(0);
+    readIndex.store(0);
+    lastWritten = {};
+    running.store(true);
+    writer = std::thread(&TraceRecorder::drain, this);
+    return true;
+}
+
+void TraceRecorder::stop(){
+    if(!traceFile) return;
+    running.store(false, std::memory_order_release);
+    writer.join();
+    fclose(traceFile);
+    traceFile = nullptr;
+    delete[] buffer;
+    buffer = nullptr;
+}
+
+void TraceRecorder::drain(){
+    while(true){
+        // Check before looking at the buffer so nothing pushed before `stop` is missed.
+        bool stopping = !running.load(std::memory_order_acquire);
+        uint64_t tail = readIndex.load(std::memory_order_relaxed);
+        uint64_t head = writeIndex.load(std::memory_order_acquire);
+
+        if(head != tail){
+            if(head - tail > TRACE_DRAIN_CHUNK) head = tail + TRACE_DRAIN_CHUNK;
+            writeRecords(tail, head);
+            readIndex.store(head, std::memory_order_release);
+            continue;
+        }
+        if(stopping) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    fflush(traceFile);
+}
+
+void TraceRecorder::writeRecords(uint64_t from, uint64_t to){
+    for(uint64_t index = from; index < to; index++){
+        const TraceRecord& record = buffer[index & (TRACE_BUFFER_SIZE - 1)];
+        if(!compressed){
+            fwrite(&record, sizeof(TraceRecord), 1, traceFile);
+            continue;
+        }
+
+        const byte* current = (const byte*)&record;
+        const byte* previous = (const byte*)&lastWritten;
+        byte packed[3 + sizeof(TraceRecord)];
+        uint32_t mask = 0;
+        size_t length = 3;
+        for(size_t i = 0; i < sizeof(TraceRecord); i++){
+            if(current[i] == previous[i]) continue;
+            mask |= 1 << i;
+            packed[length++] = current[i];
+        }
+        packed[0] = mask & 0xFF;
+        packed[1] = (mask >> 8) & 0xFF;
+        packed[2] = (mask >> 16) & 0xFF;
+        fwrite(packed, 1, length, traceFile);
+        lastWritten = record;
+    }
+}
+
+bool TraceReader::open(const std::string& filePath){
+    close();
+    traceFile = fopen(filePath.c_str(), "rb");
+    if(!traceFile){
+        std::cout << "ERROR: Could not open the trace \"" << filePath << "\"!" << std::endl;
+        return false;
+    }
+
+    char magic[sizeof(TRACE_FILE_MAGIC)];
+    uint32_t flags = 0, recordSize = 0;
+    if(fread(magic, 1, sizeof(magic), traceFile) != sizeof(magic) ||
+       fread(&flags, sizeof(flags), 1, traceFile) != 1 ||
+       fread(&recordSize, sizeof(recordSize), 1, traceFile) != 1 ||
+       std::memcmp(magic, TRACE_FILE_MAGIC, sizeof(magic)) != 0 ||
+       recordSize != sizeof(TraceRecord)){
+        std::cout << "ERROR: \"" << filePath << "\" is not a trace file!" << std::endl;
+        close();
+        return false;
+    }
+
+    compressed = flags & TRACE_FLAG_COMPRESSED;
+    last = {};
+    return true;
+}
+
+void TraceReader::close(){
+    if(traceFile) fclose(traceFile);
+    traceFile = nullptr;
+}
+
+bool TraceReader::next(TraceRecord& record){
+    if(!traceFile) return false;
+    if(!compressed) return fread(&record, sizeof(TraceRecord), 1, traceFile) == 1;
+
+    byte maskBytes[3];
+    if(fread(maskBytes, 1, 3, traceFile) != 3) return false;
+    uint32_t mask = maskBytes[0] | (maskBytes[1] << 8) | (maskBytes[2] << 16);
+    byte* current = (byte*)&last;
+    for(size_t i = 0; i < sizeof(TraceRecord); i++){
+        if(!(mask & (1 << i))) continue;
+        int value = fgetc(traceFile);
+        if(value == EOF) return false;
+        current[i] = (byte)value;
+    }
+    record = last;
+    return true;
+}
+
+std::string TraceReader::toText(const TraceRecord& record){
+    char bank[8] = "--";
+    if(record.bank != TRACE_NO_BANK) snprintf(bank, sizeof(bank), "%02X", record.bank);
+    char line[160];
+    snprintf(line, sizeof(line),
+        "%12llu %s:%04X AF:%04X BC:%04X DE:%04X HL:%04X SP:%04X %s",
+        (unsigned long long)record.timestamp, bank, record.PC,
+        record.AF, record.BC, record.DE, record.HL, record.SP,
+        Profiler::instructionName(record.opcode, record.cbOpcode).c_str());
+    return line;
+}
+
+int TraceReader::printText(const std::string& tracePath, std::ostream& output){
+    TraceReader reader;
+    if(!reader.open(tracePath)) return 2;
+    TraceRecord record;
+    while(reader.next(record)) output << toText(record) << "\n";
+    return 0;
+}
+
+int TraceReader::diff(const std::string& tracePathA, const std::string& tracePathB, std::ostream& output){
+    TraceReader readerA, readerB;
+    if(!readerA.open(tracePathA) || !readerB.open(tracePathB)) return 2;
+
+    std::deque<TraceRecord> context;
+    TraceRecord recordA, recordB;
+    uint64_t index = 0;
+    while(true){
+        bool hasA = readerA.next(recordA);
+        bool hasB = readerB.next(recordB);
+        if(!hasA && !hasB){
+            output << "The traces are identical (" << index << " instructions)." << std::endl;
+            return 0;
+        }
+        if(hasA && hasB && std::memcmp(&recordA, &recordB, sizeof(TraceRecord)) == 0){
+            context.push_back(recordA);
+            if(context.size() > TRACE_DIFF_CONTEXT) context.pop_front();
+            index++;
+            continue;
+        }
+
+        output << "The traces differ at instruction " << index << ":" << std::endl;
+        for(const TraceRecord& record : context) output << "  " << toText(record) << std::endl;
+        output << "A " << (hasA ? toText(recordA) : std::string("<end of trace>")) << std::endl;
+        output << "B " << (hasB ? toText(recordB) : std::string("<end of trace>")) << std::endl;
+        if(hasA && hasB){
+            output << "Differs in:";
+            if(recordA.timestamp != recordB.timestamp) output << " timestamp (" << (long long)(recordB.timestamp - recordA.timestamp) << " cycles)";
+            if(recordA.PC != recordB.PC || recordA.bank != recordB.bank) output << " PC";
+            if(recordA.opcode != recordB.opcode || recordA.cbOpcode != recordB.cbOpcode) output << " opcode";
+            if(recordA.AF != recordB.AF) output << " AF";
+            if(recordA.BC != recordB.BC) output << " BC";
+            if(recordA.DE != recordB.DE) output << " DE";
+            if(recordA.HL != recordB.HL) output << " HL";
+            if(recordA.SP != recordB.SP) output << " SP";
+            output << std::endl;
+        }
+        return 1;
+    }
+}
@@ -1,9 +1,25 @@
 #include "GUI\include\app.h"
+#include "core\include\core.h"
+#include "core\include\traceRecorder.h"
+#include "core\include\instructionHarness.h"
 #include <wx/wx.h>
+#include <cstring>
 
 // Implement wxWidget Application.
 wxIMPLEMENT_APP_NO_MAIN(App);
 int main(int argc, char** argv)
 {
+	// The command line tools run without the GUI.
+	if (argc == 3 && strcmp(argv[1], "--trace-text") == 0)
+		return TraceReader::printText(argv[2], std::cout);
+	if (argc == 4 && strcmp(argv[1], "--trace-diff") == 0)
+		return TraceReader::diff(argv[2], argv[3], std::cout);
+	// Checks and times the instruction handlers against single step test files.
+	if (argc >= 3 && strcmp(argv[1], "--opcode-tests") == 0)
+		return InstructionHarness().run(std::vector<std::string>(argv + 2, argv + argc), std::cout);
+	// Runs a ROM without the GUI, recording the code it runs, and writes its ahead-of-time compiled module.
+	if ((argc == 3 || argc == 4) && strcmp(argv[1], "--aot-export") == 0)
+		return Core::runAOTExport(argv[2], argc == 4 ? atoi(argv[3]) : AOT_EXPORT_FRAMES);
+
 	return wxEntry(argc, argv);
 }
@@ -0,0 +1,12 @@
+:: This script builds an ahead-of-time compiled module exported by the emu into the DLL it loads.
+:: Expected CWD is the root of the repository -> %DIR%/gb-gbc_emu/, run from a VS x64 Native Tools Command Prompt.
+:: Usage: .\scripts\buildAOTModule.bat gameName
+:: Builds .\aot\gameName.cpp into .\aot\gameName.dll.
+@echo off
+
+if "%~1"=="" (
+    exit /b 1
+)
+set moduleName=.\aot\%~1
+
+cl /nologo /O2 /LD /std:c++17 /I .\core\include %moduleName%.cpp /Fe:%moduleName%.dll /Fo:%moduleName%.obj
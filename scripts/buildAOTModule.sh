@@ -0,0 +1,12 @@
+#!/bin/sh
+# This script builds an ahead-of-time compiled module exported by the emu into the shared library it loads.
+# Expected CWD is the root of the repository -> $DIR/gb-gbc_emu/
+# Usage: ./scripts/buildAOTModule.sh gameName
+# Builds ./aot/gameName.cpp into ./aot/gameName.so.
+
+if [ -z "$1" ]; then
+    exit 1
+fi
+moduleName=./aot/$1
+
+${CXX:-g++} -O2 -shared -fPIC -std=c++17 -I ./core/include "$moduleName.cpp" -o "$moduleName.so"